@@ -5,6 +5,9 @@
 #include "classes/energykernel.h"
 #include "classes/species.h"
 #include "common/problems.h"
+#include <algorithm>
+#include <map>
+#include <vector>
 
 template <ProblemType problem, Population population> EnergyKernel createEnergyKernel(Problem<problem, population> &problemDef)
 {
@@ -49,6 +52,69 @@ template <ProblemType problem, Population population> static void BM_CalculateEn
     }
 }
 
+// Energy of every Molecule in turn from a single kernel, reusing its scratch space between calls
+template <ProblemType problem, Population population>
+static void BM_CalculateEnergy_MoleculeEnergyReusedKernel(benchmark::State &state)
+{
+    Problem<problem, population> problemDef;
+    auto energyKernel = createEnergyKernel(problemDef);
+    for (auto _ : state)
+    {
+        for (const auto &mol : problemDef.cfg_->molecules())
+        {
+            double molecularEnergy = energyKernel.energy(*mol, ProcessPool::PoolStrategy, false);
+            benchmark::DoNotOptimize(molecularEnergy);
+        }
+    }
+}
+
+// Energy of every Molecule in turn from a single kernel, including the breakdown over other Molecules
+template <ProblemType problem, Population population>
+static void BM_CalculateEnergy_MoleculeEnergyBreakdownReusedKernel(benchmark::State &state)
+{
+    Problem<problem, population> problemDef;
+    auto energyKernel = createEnergyKernel(problemDef);
+    std::vector<std::pair<int, double>> moleculeEnergies;
+    for (auto _ : state)
+    {
+        for (const auto &mol : problemDef.cfg_->molecules())
+        {
+            double molecularEnergy = energyKernel.energy(*mol, moleculeEnergies);
+            benchmark::DoNotOptimize(molecularEnergy);
+        }
+    }
+}
+
+// Grouping of Molecule atoms by Cell, as previously performed on every call to EnergyKernel::energy(const Molecule &)
+template <ProblemType problem, Population population> static void BM_GroupMoleculeAtoms_Map(benchmark::State &state)
+{
+    Problem<problem, population> problemDef;
+    const auto mol = problemDef.cfg_->molecules().front();
+    for (auto _ : state)
+    {
+        std::map<Cell *, std::vector<const Atom *>> locationMap;
+        for (auto &i : mol->atoms())
+            locationMap[i->cell()].push_back(i.get());
+        benchmark::DoNotOptimize(locationMap);
+    }
+}
+
+// Grouping of Molecule atoms by Cell into a reused, sorted flat buffer, as now performed by EnergyKernel
+template <ProblemType problem, Population population> static void BM_GroupMoleculeAtoms_SortedBuffer(benchmark::State &state)
+{
+    Problem<problem, population> problemDef;
+    const auto mol = problemDef.cfg_->molecules().front();
+    std::vector<std::pair<int, const Atom *>> cellAtoms;
+    for (auto _ : state)
+    {
+        cellAtoms.clear();
+        for (auto &i : mol->atoms())
+            cellAtoms.emplace_back(i->cell()->index(), i.get());
+        std::sort(cellAtoms.begin(), cellAtoms.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        benchmark::DoNotOptimize(cellAtoms.data());
+    }
+}
+
 template <ProblemType problem, Population population> static void BM_CalculateEnergy_MoleculeBondEnergy(benchmark::State &state)
 {
     Problem<problem, population> problemDef;
@@ -151,6 +217,15 @@ BENCHMARK_TEMPLATE(BM_CalculateEnergy_MoleculeEnergy, ProblemType::mediumMolecul
     ->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_CalculateEnergy_MoleculeEnergy, ProblemType::mediumMolecule, Population::medium)
     ->Unit(benchmark::kMillisecond);
+// Benchmark repeated molecule energy calculations on a single kernel, and the per-call cost of grouping atoms by cell
+// with the previous (map) and current (sorted buffer) approaches
+BENCHMARK_TEMPLATE(BM_CalculateEnergy_MoleculeEnergyReusedKernel, ProblemType::mediumMolecule, Population::small)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupMoleculeAtoms_Map, ProblemType::mediumMolecule, Population::small);
+BENCHMARK_TEMPLATE(BM_GroupMoleculeAtoms_SortedBuffer, ProblemType::mediumMolecule, Population::small);
+// Benchmark molecule energy calculations including the breakdown over other molecules, as used by the energy cache
+BENCHMARK_TEMPLATE(BM_CalculateEnergy_MoleculeEnergyBreakdownReusedKernel, ProblemType::mediumMolecule, Population::small)
+    ->Unit(benchmark::kMillisecond);
 
 // Benchmark energy calculations of the whole system
 BENCHMARK_TEMPLATE(BM_CalculateEnergy_TotalIntraMolecularEnergy, ProblemType::mediumMolecule, Population::small)
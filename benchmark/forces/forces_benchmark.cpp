@@ -4,6 +4,7 @@
 #include "classes/cell.h"
 #include "classes/forcekernel.h"
 #include "classes/species.h"
+#include "classes/verletlist.h"
 #include "common/problems.h"
 #include "modules/forces/forces.h"
 
@@ -13,7 +14,7 @@ template <ProblemType problem, Population population> ForceKernel createForceKer
     auto &procPool = problemDef.dissolve_.worldPool();
     const PotentialMap &potentialMap = problemDef.dissolve_.potentialMap();
     auto *cfg = problemDef.cfg_;
-    ForceKernel kernel(procPool, cfg->box(), potentialMap);
+    ForceKernel kernel(procPool, cfg, potentialMap);
     return kernel;
 }
 
@@ -100,6 +101,23 @@ template <ProblemType problem, Population population> static void BM_CalculateFo
     }
 }
 
+template <ProblemType problem, Population population>
+static void BM_CalculateForces_TotalInterAtomicVerlet(benchmark::State &state)
+{
+
+    Problem<problem, population> problemDef;
+    auto *cfg = problemDef.cfg_;
+    auto &procPool = problemDef.dissolve_.worldPool();
+    const PotentialMap &potentialMap = problemDef.dissolve_.potentialMap();
+    VerletList verletList(0.5);
+    verletList.generate(cfg, potentialMap.range());
+    for (auto _ : state)
+    {
+        std::vector<Vec3<double>> forces(cfg->nAtoms());
+        ForcesModule::interAtomicForces(procPool, cfg, potentialMap, verletList, forces);
+    }
+}
+
 template <ProblemType problem, Population population> static void BM_CalculateForces_TotalForces(benchmark::State &state)
 {
 
@@ -114,6 +132,20 @@ template <ProblemType problem, Population population> static void BM_CalculateFo
         ForcesModule::totalForces(procPool, cfg, potentialMap, forces);
     }
 }
+template <ProblemType problem, Population population>
+static void BM_CalculateForces_TotalEnergyAndForces(benchmark::State &state)
+{
+
+    Problem<problem, population> problemDef;
+    auto *cfg = problemDef.cfg_;
+    auto &procPool = problemDef.dissolve_.worldPool();
+    const PotentialMap &potentialMap = problemDef.dissolve_.potentialMap();
+    for (auto _ : state)
+    {
+        std::vector<Vec3<double>> forces(cfg->nAtoms());
+        benchmark::DoNotOptimize(ForcesModule::totalEnergyAndForces(procPool, cfg, potentialMap, forces));
+    }
+}
 // small molecule benchmarks
 BENCHMARK_TEMPLATE(BM_CalculateForces_InterAtomic, ProblemType::smallMolecule, Population::small)
     ->Unit(benchmark::kMillisecond);
@@ -124,9 +156,15 @@ BENCHMARK_TEMPLATE(BM_CalculateForces_TotalIntraMolecular, ProblemType::smallMol
 BENCHMARK_TEMPLATE(BM_CalculateForces_TotalInterAtomic, ProblemType::smallMolecule, Population::small)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CalculateForces_TotalInterAtomicVerlet, ProblemType::smallMolecule, Population::small)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_CalculateForces_TotalForces, ProblemType::smallMolecule, Population::small)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CalculateForces_TotalEnergyAndForces, ProblemType::smallMolecule, Population::small)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
 
 // medium molecule benchmarks
 BENCHMARK_TEMPLATE(BM_CalculateForces_InterAtomic, ProblemType::mediumMolecule, Population::small)
@@ -137,8 +175,14 @@ BENCHMARK_TEMPLATE(BM_CalculateForces_SpeciesTorsion, ProblemType::mediumMolecul
 BENCHMARK_TEMPLATE(BM_CalculateForces_TotalInterAtomic, ProblemType::mediumMolecule, Population::small)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CalculateForces_TotalInterAtomicVerlet, ProblemType::mediumMolecule, Population::small)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_CalculateForces_TotalIntraMolecular, ProblemType::mediumMolecule, Population::small)
     ->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_CalculateForces_TotalForces, ProblemType::mediumMolecule, Population::small)
     ->Iterations(5)
-    ->Unit(benchmark::kMillisecond);
\ No newline at end of file
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CalculateForces_TotalEnergyAndForces, ProblemType::mediumMolecule, Population::small)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
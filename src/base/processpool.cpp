@@ -50,6 +50,10 @@ void ProcessPool::operator=(const ProcessPool &source)
 
     // Random number buffer
     // ???
+
+    // Random streams
+    randomStreamSeed_ = source.randomStreamSeed_;
+    randomStreamSet_ = source.randomStreamSet_;
 }
 
 // Clear all data
@@ -1547,3 +1551,32 @@ double ProcessPool::randomPlusMinusOne()
     return DissolveMath::randomPlusMinusOne();
 #endif
 }
+
+/*
+ * Counter-Based Random Streams
+ */
+
+// Set seed for random streams (must be identical on all processes)
+void ProcessPool::setRandomStreamSeed(std::uint64_t seed)
+{
+    randomStreamSeed_ = seed;
+    randomStreamSet_ = 0;
+}
+
+// Begin a new set of random streams (must be called by all processes)
+void ProcessPool::nextRandomStreamSet() { ++randomStreamSet_; }
+
+// Return random stream from the current set, shared between processes in the same way as the buffered random numbers
+RandomStream ProcessPool::randomStream(ProcessPool::DivisionStrategy strategy, std::uint32_t substream) const
+{
+    // Processes which would share a random number buffer under the specified strategy (see initialiseRandomBuffer()) are
+    // given the same stream, and the strategy is encoded in the stream identifier so that streams for different strategies
+    // within the same set are distinct
+    std::uint32_t stream = 0;
+    if (strategy == ProcessPool::GroupProcessesStrategy)
+        stream = groupIndex_;
+    else if (strategy == ProcessPool::PoolProcessesStrategy)
+        stream = poolRank_;
+
+    return {randomStreamSeed_, randomStreamSet_, (std::uint32_t(strategy) << 24) + stream, substream};
+}
@@ -7,6 +7,7 @@
 #define RANDBUFFERSIZE 16172
 
 #include "base/processgroup.h"
+#include "base/randomstream.h"
 #include "base/timer.h"
 #include "templates/vector3.h"
 // Include <mpi.h> only if we are compiling in parallel
@@ -355,6 +356,23 @@ class ProcessPool
     // Get next buffered random number (-1 to +1 inclusive)
     double randomPlusMinusOne();
 
+    /*
+     * Counter-Based Random Streams
+     */
+    private:
+    // Seed for random streams (identical on all processes)
+    std::uint64_t randomStreamSeed_{0};
+    // Index of current set of random streams
+    std::uint32_t randomStreamSet_{0};
+
+    public:
+    // Set seed for random streams (must be identical on all processes)
+    void setRandomStreamSeed(std::uint64_t seed);
+    // Begin a new set of random streams (must be called by all processes)
+    void nextRandomStreamSet();
+    // Return random stream from the current set, shared between processes in the same way as the buffered random numbers
+    RandomStream randomStream(ProcessPool::DivisionStrategy strategy, std::uint32_t substream = 0) const;
+
     /*
      * Macro Variables
      */
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/randomstream.h"
+
+RandomStream::RandomStream(std::uint64_t seed, std::uint32_t set, std::uint32_t stream, std::uint32_t substream)
+    : key_{std::uint32_t(seed), std::uint32_t(seed >> 32)}, counter_{0, set, stream, substream}, blockIndex_(4)
+{
+}
+
+/*
+ * Generation
+ */
+
+// Return Philox4x32-10 output for the supplied counter and key
+std::array<std::uint32_t, 4> RandomStream::philox(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key)
+{
+    const std::uint64_t multiplier0 = 0xD2511F53, multiplier1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+
+    for (auto round = 0; round < 10; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+
+        const auto product0 = multiplier0 * counter[0];
+        const auto product1 = multiplier1 * counter[2];
+        counter = {std::uint32_t(product1 >> 32) ^ counter[1] ^ key[0], std::uint32_t(product1),
+                   std::uint32_t(product0 >> 32) ^ counter[3] ^ key[1], std::uint32_t(product0)};
+    }
+
+    return counter;
+}
+
+/*
+ * Random Numbers
+ */
+
+// Return next raw random value
+RandomStream::result_type RandomStream::operator()()
+{
+    if (blockIndex_ == 4)
+    {
+        block_ = philox(counter_, key_);
+        ++counter_[0];
+        blockIndex_ = 0;
+    }
+
+    return block_[blockIndex_++];
+}
+
+// Return next random number (0 to 1, exclusive of 1)
+double RandomStream::random()
+{
+    // Combine two raw values to give 53 random bits
+    const std::uint64_t a = (*this)() >> 5, b = (*this)() >> 6;
+    return double((a << 26) + b) * (1.0 / 9007199254740992.0);
+}
+
+// Return next random number (-1 to +1)
+double RandomStream::randomPlusMinusOne() { return random() * 2.0 - 1.0; }
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// Counter-Based Random Stream
+class RandomStream
+{
+    /*
+     * Philox4x32-10 counter-based random number generator (Salmon et al., Proc. SC11, 2011). Every number in a stream is a
+     * pure function of the seed, the stream identifiers, and its position in the stream, so identical streams may be produced
+     * on any process without communication, and independent streams may be used concurrently from separate threads.
+     */
+
+    public:
+    RandomStream(std::uint64_t seed = 0, std::uint32_t set = 0, std::uint32_t stream = 0, std::uint32_t substream = 0);
+    ~RandomStream() = default;
+
+    /*
+     * Generation
+     */
+    private:
+    // Key, derived from the seed
+    std::array<std::uint32_t, 2> key_;
+    // Counter, comprising the block index within the stream and the stream identifiers
+    std::array<std::uint32_t, 4> counter_;
+    // Current block of generated values
+    std::array<std::uint32_t, 4> block_;
+    // Index of next unused value in the current block
+    int blockIndex_;
+
+    public:
+    // Return Philox4x32-10 output for the supplied counter and key
+    static std::array<std::uint32_t, 4> philox(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key);
+
+    /*
+     * Random Numbers
+     */
+    public:
+    // Type of raw random values (for use as a UniformRandomBitGenerator)
+    using result_type = std::uint32_t;
+    // Return minimum raw random value
+    static constexpr result_type min() { return 0; }
+    // Return maximum raw random value
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    // Return next raw random value
+    result_type operator()();
+    // Return next random number (0 to 1, exclusive of 1)
+    double random();
+    // Return next random number (-1 to +1)
+    double randomPlusMinusOne();
+};
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/atomarrays.h"
+#include "classes/atom.h"
+#include "classes/molecule.h"
+#include <cassert>
+
+// Clear all data
+void AtomArrays::clear()
+{
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    localTypeIndices_.clear();
+    masterTypeIndices_.clear();
+    moleculeIndices_.clear();
+}
+
+/*
+ * Data
+ */
+
+// Append data for the specified Atom
+void AtomArrays::add(const Atom &i)
+{
+    assert(i.arrayIndex() == x_.size());
+
+    x_.push_back(i.x());
+    y_.push_back(i.y());
+    z_.push_back(i.z());
+    localTypeIndices_.push_back(i.localTypeIndex());
+    masterTypeIndices_.push_back(i.masterTypeIndex());
+    moleculeIndices_.push_back(i.molecule() ? i.molecule()->arrayIndex() : -1);
+}
+
+// Update stored coordinates for the specified Atom
+void AtomArrays::updateCoordinates(const Atom &i)
+{
+    auto index = i.arrayIndex();
+    assert(index >= 0 && index < x_.size());
+
+    x_[index] = i.x();
+    y_[index] = i.y();
+    z_[index] = i.z();
+}
+
+// Regenerate all data from the supplied Atom vector
+void AtomArrays::update(const std::vector<std::shared_ptr<Atom>> &atoms)
+{
+    clear();
+
+    x_.reserve(atoms.size());
+    y_.reserve(atoms.size());
+    z_.reserve(atoms.size());
+    localTypeIndices_.reserve(atoms.size());
+    masterTypeIndices_.reserve(atoms.size());
+    moleculeIndices_.reserve(atoms.size());
+
+    for (const auto &i : atoms)
+        add(*i);
+}
+
+// Return number of Atoms represented
+int AtomArrays::nAtoms() const { return x_.size(); }
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+#include <memory>
+#include <vector>
+
+// Forward Declarations
+class Atom;
+
+// Atom Arrays
+class AtomArrays
+{
+    /*
+     * Structure-of-arrays mirror of the Atom data in a Configuration, indexed by Atom::arrayIndex(), for use in
+     * performance-critical loops where chasing individual Atom pointers is a bottleneck.
+     */
+
+    public:
+    AtomArrays() = default;
+    ~AtomArrays() = default;
+    // Clear all data
+    void clear();
+
+    /*
+     * Data
+     */
+    private:
+    // Atomic coordinates
+    std::vector<double> x_, y_, z_;
+    // Local AtomType indices
+    std::vector<int> localTypeIndices_;
+    // Master AtomType indices
+    std::vector<int> masterTypeIndices_;
+    // Indices of parent Molecules
+    std::vector<int> moleculeIndices_;
+
+    public:
+    // Append data for the specified Atom
+    void add(const Atom &i);
+    // Update stored coordinates for the specified Atom
+    void updateCoordinates(const Atom &i);
+    // Regenerate all data from the supplied Atom vector
+    void update(const std::vector<std::shared_ptr<Atom>> &atoms);
+    // Return number of Atoms represented
+    int nAtoms() const;
+    // Return coordinates of specified Atom
+    Vec3<double> r(int index) const { return {x_[index], y_[index], z_[index]}; }
+    // Return x coordinate array
+    const double *x() const { return x_.data(); }
+    // Return y coordinate array
+    const double *y() const { return y_.data(); }
+    // Return z coordinate array
+    const double *z() const { return z_.data(); }
+    // Return local AtomType index array
+    const int *localTypeIndices() const { return localTypeIndices_.data(); }
+    // Return master AtomType index array
+    const int *masterTypeIndices() const { return masterTypeIndices_.data(); }
+    // Return Molecule index array
+    const int *moleculeIndices() const { return moleculeIndices_.data(); }
+};
@@ -46,6 +46,9 @@ const Vec3<double> &Cell::centre() const { return centre_; }
 std::vector<Atom *> &Cell::atoms() { return atoms_; }
 const std::vector<Atom *> &Cell::atoms() const { return atoms_; }
 
+// Return array indices of contained Atoms
+const std::vector<int> &Cell::atomIndices() const { return atomIndices_; }
+
 // Return number of Atoms in list
 int Cell::nAtoms() const { return atoms_.size(); }
 
@@ -54,6 +57,7 @@ void Cell::addAtom(Atom *atom)
 {
     assert(atom);
     atoms_.push_back(atom);
+    atomIndices_.push_back(atom->arrayIndex());
 
     if (atom->cell())
         Messenger::warn("About to set Cell pointer in Atom {}, but this will overwrite an existing value.\n",
@@ -67,9 +71,17 @@ void Cell::removeAtom(Atom *atom)
     auto it = std::find(atoms_.begin(), atoms_.end(), atom);
     assert(it != atoms_.end());
     (*it)->setCell(nullptr);
+    atomIndices_.erase(atomIndices_.begin() + (it - atoms_.begin()));
     atoms_.erase(it);
 }
 
+// Update stored Atom array indices
+void Cell::updateAtomIndices()
+{
+    atomIndices_.resize(atoms_.size());
+    std::transform(atoms_.begin(), atoms_.end(), atomIndices_.begin(), [](const auto *i) { return i->arrayIndex(); });
+}
+
 /*
  * Neighbours
  */
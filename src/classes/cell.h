@@ -52,17 +52,23 @@ class Cell
     private:
     // Array of Atoms contained in this Cell
     std::vector<Atom *> atoms_;
+    // Array indices of Atoms contained in this Cell (in the same order as atoms_)
+    std::vector<int> atomIndices_;
 
     public:
     // Return array of contained Atoms
     std::vector<Atom *> &atoms();
     const std::vector<Atom *> &atoms() const;
+    // Return array indices of contained Atoms
+    const std::vector<int> &atomIndices() const;
     // Return number of Atoms in array
     int nAtoms() const;
     // Add atom to Cell
     void addAtom(Atom *atom);
     // Remove Atom from Cell
     void removeAtom(Atom *atom);
+    // Update stored Atom array indices
+    void updateAtomIndices();
 
     /*
      * Neighbours
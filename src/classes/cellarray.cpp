@@ -37,6 +37,12 @@ const Cell *CellArray::cell(int x, int y, int z) const
 }
 
 // Retrieve Cell with id specified
+Cell *CellArray::cell(int id)
+{
+    assert(id >= 0 && id < cells_.size());
+
+    return &cells_[id];
+}
 const Cell *CellArray::cell(int id) const
 {
     assert(id >= 0 && id < cells_.size());
@@ -205,6 +211,165 @@ void CellArray::createCellNeighbourPairs()
             if (cell.index() < otherCell->index())
                 neighbourPairs_.emplace_back(cell, *otherCell, true);
     }
+
+    colourCellNeighbourPairs();
+}
+
+// Colour cell neighbour pairs so that pairs of the same colour share no Cells
+void CellArray::colourCellNeighbourPairs()
+{
+    /*
+     * Greedy edge colouring of the Cell neighbour graph - each pair is given the lowest colour not yet used by either of
+     * its Cells. Pairs within a colour can then be processed concurrently, each writing to the data of its own Atoms only.
+     */
+
+    neighbourPairColours_.clear();
+    std::vector<std::vector<bool>> cellColours(cells_.size());
+    for (auto n = 0; n < neighbourPairs_.size(); ++n)
+    {
+        auto &masterColours = cellColours[neighbourPairs_[n].master_.index()];
+        auto &neighbourColours = cellColours[neighbourPairs_[n].neighbour_.index()];
+
+        auto colour = 0;
+        while ((colour < masterColours.size() && masterColours[colour]) ||
+               (colour < neighbourColours.size() && neighbourColours[colour]))
+            ++colour;
+
+        if (colour >= masterColours.size())
+            masterColours.resize(colour + 1, false);
+        masterColours[colour] = true;
+        if (colour >= neighbourColours.size())
+            neighbourColours.resize(colour + 1, false);
+        neighbourColours[colour] = true;
+
+        if (colour >= neighbourPairColours_.size())
+            neighbourPairColours_.resize(colour + 1);
+        neighbourPairColours_[colour].push_back(n);
+    }
+}
+
+// Return cell extents out from a central cell required to cover the specified range
+Vec3<int> CellArray::extents(double range) const
+{
+    Vec3<double> r;
+    Matrix3 cellAxes = box_->axes();
+    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
+    Vec3<int> ext;
+
+    // Establish a maximal extent in principal directions...
+    for (auto n = 0; n < 3; ++n)
+    {
+        do
+        {
+            r.zero();
+            ++ext[n];
+            r[n] = ext[n];
+            r = cellAxes * r;
+        } while (r[n] < range);
+
+        // If we require a larger number of cells than the box physically has along this direction, reduce it accordingly
+        if ((ext[n] * 2 + 1) > divisions_.get(n))
+            ext[n] = divisions_.get(n) / 2;
+    }
+
+    return ext;
+}
+
+// Return unique relative grid references of all Cells (excluding the central one) within the specified range
+std::vector<Vec3<int>> CellArray::neighbourGridDeltas(double range) const
+{
+    Vec3<double> r;
+    Matrix3 cellAxes = box_->axes();
+    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
+    auto ext = extents(range);
+
+    // Loop over extent integers and construct list of gridReferences within range
+    std::vector<Vec3<int>> neighbourIndices;
+    RefList<const Cell> cellNbrs;
+    Vec3<int> i, j;
+    const Cell *nbr;
+    for (auto x = -ext.x; x <= ext.x; ++x)
+    {
+        for (auto y = -ext.y; y <= ext.y; ++y)
+        {
+            for (auto z = -ext.z; z <= ext.z; ++z)
+            {
+                if ((x == 0) && (y == 0) && (z == 0))
+                    continue;
+
+                // Check a nominal central cell at (0,0,0) and this grid reference to see if any pairs of
+                // corners are in range
+                auto close = false;
+                for (auto iCorner = 0; iCorner < 8; ++iCorner)
+                {
+                    // Set integer vertex of corner on 'central' box
+                    i.set(iCorner & 1 ? 1 : 0, iCorner & 2 ? 1 : 0, iCorner & 4 ? 1 : 0);
+
+                    for (auto jCorner = 0; jCorner < 8; ++jCorner)
+                    {
+                        // Set integer vertex of corner on 'other' box
+                        j.set(x + (jCorner & 1 ? 1 : 0), y + (jCorner & 2 ? 1 : 0), z + (jCorner & 4 ? 1 : 0));
+
+                        // Get minimum image of vertex j w.r.t. i
+                        j = mimGridDelta(j - i);
+
+                        r.set(j.x, j.y, j.z);
+                        r = cellAxes * r;
+                        if (r.magnitude() < range)
+                        {
+                            close = true;
+                            break;
+                        }
+                    }
+                    if (close)
+                        break;
+                }
+                if (!close)
+                    continue;
+
+                // Check that the cell is not already in the list by querying the cellNbrs RefList
+                nbr = cell(x, y, z);
+                if (cellNbrs.contains(nbr))
+                    continue;
+                neighbourIndices.emplace_back(x, y, z);
+                cellNbrs.append(nbr);
+            }
+        }
+    }
+
+    return neighbourIndices;
+}
+
+// Return all unique pairs of Cells (including each Cell with itself) which may contain atoms within the specified range
+std::vector<std::pair<const Cell *, const Cell *>> CellArray::neighbourPairs(double range) const
+{
+    auto neighbourIndices = neighbourGridDeltas(range);
+
+    // Construct unique (ordered) index pairs from the relative grid references around each Cell
+    std::vector<std::pair<int, int>> indexPairs;
+    indexPairs.reserve(cells_.size() * (neighbourIndices.size() / 2 + 1));
+    for (auto &cell : cells_)
+    {
+        indexPairs.emplace_back(cell.index(), cell.index());
+
+        auto &gridRef = cell.gridReference();
+        for (auto &indices : neighbourIndices)
+        {
+            auto *nbr = this->cell(gridRef.x + indices.x, gridRef.y + indices.y, gridRef.z + indices.z);
+            if (cell.index() < nbr->index())
+                indexPairs.emplace_back(cell.index(), nbr->index());
+            else if (nbr->index() < cell.index())
+                indexPairs.emplace_back(nbr->index(), cell.index());
+        }
+    }
+    std::sort(indexPairs.begin(), indexPairs.end());
+    indexPairs.erase(std::unique(indexPairs.begin(), indexPairs.end()), indexPairs.end());
+
+    std::vector<std::pair<const Cell *, const Cell *>> pairs(indexPairs.size());
+    std::transform(indexPairs.begin(), indexPairs.end(), pairs.begin(),
+                   [&](const auto &ij) { return std::make_pair(&cells_[ij.first], &cells_[ij.second]); });
+
+    return pairs;
 }
 
 // Return neighbour vector for specified cell, including self as first item
@@ -213,6 +378,9 @@ const std::vector<CellNeighbour> &CellArray::neighbours(const Cell &cell) const
 // Return vector of all unique cell neighbour pairs
 const std::vector<CellNeighbourPair> &CellArray::getCellNeighbourPairs() const { return neighbourPairs_; }
 
+// Return indices of unique cell neighbour pairs, grouped into colours within which no Cell appears more than once
+const std::vector<std::vector<int>> &CellArray::getCellNeighbourPairColours() const { return neighbourPairColours_; }
+
 /*
  * Generation
  */
@@ -357,82 +525,10 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
     Messenger::print("Creating cell neighbour lists...\n");
 
     // Make a list of integer vectors which we'll then use to pick Cells for the neighbour lists
-    Vec3<double> r;
-    Matrix3 cellAxes = box_->axes();
-    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
-    extents_.zero();
-
-    // First, establish a maximal extent in principal directions...
-    for (auto n = 0; n < 3; ++n)
-    {
-        do
-        {
-            r.zero();
-            ++extents_[n];
-            r[n] = extents_[n];
-            r = cellAxes * r;
-        } while (r[n] < pairPotentialRange);
-
-        // If we require a larger number of cells than the box physically has along this direction, reduce it accordingly
-        if ((extents_[n] * 2 + 1) > divisions_[n])
-            extents_[n] = divisions_[n] / 2;
-    }
+    extents_ = extents(pairPotentialRange);
     Messenger::print("Cell extents required to cover PairPotential range are (x,y,z) = ({},{},{}).\n", extents_.x, extents_.y,
                      extents_.z);
-
-    // Now, loop over extent integers and construct list of gridReferences within range
-    std::vector<Vec3<int>> neighbourIndices;
-    RefList<const Cell> cellNbrs;
-    Vec3<int> i, j;
-    const Cell *nbr;
-    for (auto x = -extents_.x; x <= extents_.x; ++x)
-    {
-        for (auto y = -extents_.y; y <= extents_.y; ++y)
-        {
-            for (auto z = -extents_.z; z <= extents_.z; ++z)
-            {
-                if ((x == 0) && (y == 0) && (z == 0))
-                    continue;
-
-                // Check a nominal central cell at (0,0,0) and this grid reference to see if any pairs of
-                // corners are in range
-                auto close = false;
-                for (auto iCorner = 0; iCorner < 8; ++iCorner)
-                {
-                    // Set integer vertex of corner on 'central' box
-                    i.set(iCorner & 1 ? 1 : 0, iCorner & 2 ? 1 : 0, iCorner & 4 ? 1 : 0);
-
-                    for (auto jCorner = 0; jCorner < 8; ++jCorner)
-                    {
-                        // Set integer vertex of corner on 'other' box
-                        j.set(x + (jCorner & 1 ? 1 : 0), y + (jCorner & 2 ? 1 : 0), z + (jCorner & 4 ? 1 : 0));
-
-                        // Get minimum image of vertex j w.r.t. i
-                        j = mimGridDelta(j - i);
-
-                        r.set(j.x, j.y, j.z);
-                        r = cellAxes * r;
-                        if (r.magnitude() < pairPotentialRange)
-                        {
-                            close = true;
-                            break;
-                        }
-                    }
-                    if (close)
-                        break;
-                }
-                if (!close)
-                    continue;
-
-                // Check that the cell is not already in the list by querying the cellNbrs RefList
-                nbr = cell(x, y, z);
-                if (cellNbrs.contains(nbr))
-                    continue;
-                neighbourIndices.emplace_back(x, y, z);
-                cellNbrs.append(nbr);
-            }
-        }
-    }
+    auto neighbourIndices = neighbourGridDeltas(pairPotentialRange);
     Messenger::print("Added {} Cells to representative neighbour list.\n", neighbourIndices.size());
 
     // Construct neighbour arrays for individual Cells
@@ -457,6 +553,7 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
     // Finally, loop over Cells and set neighbours, and construct neighbour matrix
     Messenger::print("Constructing neighbour lists for individual Cells...\n");
     std::vector<const Cell *> nearNeighbours, mimNeighbours;
+    const Cell *nbr;
     Vec3<int> gridRef, delta;
     for (auto &cell : cells_)
     {
@@ -488,7 +585,13 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
 }
 
 // Clear Cell arrays
-void CellArray::clear() { cells_.clear(); }
+void CellArray::clear()
+{
+    neighbourPairColours_.clear();
+    neighbourPairs_.clear();
+    neighbours_.clear();
+    cells_.clear();
+}
 
 /*
  * Operations
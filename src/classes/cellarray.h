@@ -44,6 +44,7 @@ class CellArray
     // Retrieve Cell with (wrapped) grid reference specified
     const Cell *cell(int x, int y, int z) const;
     // Retrieve Cell with id specified
+    Cell *cell(int id);
     const Cell *cell(int id) const;
     // Return Cell which contains specified coordinate
     Cell *cell(const Vec3<double> r);
@@ -63,6 +64,8 @@ class CellArray
     private:
     // Neighbour pair array (one-dimensional)
     std::vector<CellNeighbourPair> neighbourPairs_;
+    // Neighbour pair indices grouped into colours, within which no Cell appears more than once
+    std::vector<std::vector<int>> neighbourPairColours_;
     // Neighbour array per Cell
     std::vector<std::vector<CellNeighbour>> neighbours_;
 
@@ -71,12 +74,22 @@ class CellArray
     void addNeighbour(const Cell &cell, const Cell &nbr, bool useMim);
     // Construct cell neighbour pairs
     void createCellNeighbourPairs();
+    // Colour cell neighbour pairs so that pairs of the same colour share no Cells
+    void colourCellNeighbourPairs();
 
     public:
+    // Return cell extents out from a central cell required to cover the specified range
+    Vec3<int> extents(double range) const;
+    // Return unique relative grid references of all Cells (excluding the central one) within the specified range
+    std::vector<Vec3<int>> neighbourGridDeltas(double range) const;
+    // Return all unique pairs of Cells (including each Cell with itself) which may contain atoms within the specified range
+    std::vector<std::pair<const Cell *, const Cell *>> neighbourPairs(double range) const;
     // Return neighbour vector for specified cell, including self as first item
     const std::vector<CellNeighbour> &neighbours(const Cell &cell) const;
     // Return vector of all unique cell neighbour pairs
     const std::vector<CellNeighbourPair> &getCellNeighbourPairs() const;
+    // Return indices of unique cell neighbour pairs, grouped into colours within which no Cell appears more than once
+    const std::vector<std::vector<int>> &getCellNeighbourPairColours() const;
 
     /*
      * Generation
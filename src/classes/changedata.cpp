@@ -20,6 +20,7 @@ void ChangeData::setAtom(Atom *i)
     atom_ = i;
     moved_ = false;
     r_ = atom_->r();
+    r0_ = r_;
     cell_ = i->cell();
 }
 
@@ -56,3 +57,6 @@ bool ChangeData::hasMoved() { return moved_; }
 
 // Return position vector
 Vec3<double> ChangeData::r() const { return r_; }
+
+// Return original position vector
+Vec3<double> ChangeData::originalR() const { return r0_; }
@@ -27,6 +27,8 @@ class ChangeData
     bool moved_{false};
     // Stored coordinates of Atom
     Vec3<double> r_;
+    // Original coordinates of Atom, at the point it was set as the target
+    Vec3<double> r0_;
     // Stored Cell of Atom
     Cell *cell_{nullptr};
 
@@ -45,4 +47,6 @@ class ChangeData
     bool hasMoved();
     // Return position vector
     Vec3<double> r() const;
+    // Return original position vector
+    Vec3<double> originalR() const;
 };
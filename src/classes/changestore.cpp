@@ -7,10 +7,11 @@
 #include "classes/cell.h"
 #include "classes/configuration.h"
 #include "classes/molecule.h"
+#include <map>
 #include <memory>
 #include <utility>
 
-ChangeStore::ChangeStore(ProcessPool &procPool) : processPool_(procPool) {}
+ChangeStore::ChangeStore(ProcessPool &procPool, Configuration *cfg) : configuration_(cfg), processPool_(procPool) {}
 
 /*
  * Watch Targets
@@ -65,9 +66,12 @@ void ChangeStore::updateAtom(int id)
 void ChangeStore::revertAll()
 {
     for (auto &item : targetAtoms_)
+    {
         // revertPosition can make alterations to the cell that
         // contains the item, so it cannot be safely run in parallel.
         item.revertPosition();
+        configuration_->updateCellLocation(item.atom());
+    }
 }
 
 // Revert specified index to stored position
@@ -75,6 +79,7 @@ void ChangeStore::revert(int id)
 {
     assert(id >= 0 && id < targetAtoms_.size());
     targetAtoms_[id].revertPosition();
+    configuration_->updateCellLocation(targetAtoms_[id].atom());
 }
 
 // Save Atom changes for broadcast, and reset arrays for new data
@@ -95,7 +100,7 @@ void ChangeStore::storeAndReset()
 }
 
 // Distribute and apply changes
-bool ChangeStore::distributeAndApply(Configuration *cfg)
+bool ChangeStore::distributeAndApply()
 {
 #ifdef PARALLEL
     // First, get total number of changes across all processes
@@ -143,23 +148,35 @@ bool ChangeStore::distributeAndApply(Configuration *cfg)
     if (!processPool_.broadcast(z_))
         return false;
 
+    // Atoms changed locally are already at their new positions, so get their original positions for the change log
+    std::map<int, Vec3<double>> localOriginalR;
+    for (auto &data : changes_)
+        localOriginalR.emplace(data.atomArrayIndex(), data.originalR());
+
     // Apply atom changes
-    std::vector<std::shared_ptr<Atom>> &atoms = cfg->atoms();
+    std::vector<std::shared_ptr<Atom>> &atoms = configuration_->atoms();
     for (auto n = 0; n < nTotalChanges; ++n)
     {
-        assert(indices_[n] >= 0 && indices_[n] < cfg->nAtoms());
+        assert(indices_[n] >= 0 && indices_[n] < configuration_->nAtoms());
+
+        // Log the original position of the atom
+        auto it = localOriginalR.find(indices_[n]);
+        configuration_->logAtomMove(indices_[n], it == localOriginalR.end() ? atoms[indices_[n]]->r() : it->second);
 
         // Set new coordinates and update cell position
         atoms[indices_[n]]->setCoordinates(x_[n], y_[n], z_[n]);
-        cfg->updateCellLocation(atoms[indices_[n]].get());
+        configuration_->updateCellLocation(atoms[indices_[n]].get());
     }
 #else
     // Apply atom changes
     for (auto &data : changes_)
     {
+        // Log the original position of the atom
+        configuration_->logAtomMove(data.atomArrayIndex(), data.originalR());
+
         // Set new coordinates and check cell position (Configuration::updateAtomInCell() will do all this)
         data.revertPosition();
-        cfg->updateCellLocation(data.atom());
+        configuration_->updateCellLocation(data.atom());
     }
 #endif
 
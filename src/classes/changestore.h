@@ -17,9 +17,16 @@ class ProcessPool;
 class ChangeStore
 {
     public:
-    ChangeStore(ProcessPool &procPool);
+    ChangeStore(ProcessPool &procPool, Configuration *cfg);
     ~ChangeStore() = default;
 
+    /*
+     * Target Configuration
+     */
+    private:
+    // Configuration in which the watched Atoms exist
+    Configuration *configuration_;
+
     /*
      * Watch Targets
      */
@@ -69,5 +76,5 @@ class ChangeStore
 
     public:
     // Distribute and apply change data to all processes
-    bool distributeAndApply(Configuration *cfg);
+    bool distributeAndApply();
 };
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/checkerboarddistributor.h"
+#include "classes/cell.h"
+#include "classes/cellarray.h"
+#include <cassert>
+
+CheckerboardDistributor::CheckerboardDistributor(const CellArray &cellArray, double modificationRange) : cellArray_(cellArray)
+{
+    /*
+     * Objects are assigned to the block containing their reference Cell, and may modify Cells within the modificationRange
+     * of that block. Energy calculations then read Cells neighbouring those, so two blocks of the same colour must be
+     * separated by at least twice the modification extent plus the neighbour extent of the CellArray. Blocks alternate in
+     * colour along each axis, so any axis we divide must contain an even number of blocks of at least this size - if it
+     * cannot, it is not divided at all.
+     */
+    const auto modificationExtents = cellArray_.extents(modificationRange);
+    const auto neighbourExtents = cellArray_.extents();
+    const auto divisions = cellArray_.divisions();
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        auto minBlockSize = 2 * modificationExtents.get(axis) + neighbourExtents.get(axis);
+        nBlocks_.set(axis, 2 * (divisions.get(axis) / (2 * std::max(1, minBlockSize))));
+        if (nBlocks_.get(axis) < 4)
+            nBlocks_.set(axis, 1);
+    }
+
+    // Assign blocks to colours
+    blockTargets_.resize(nBlocks_.x * nBlocks_.y * nBlocks_.z);
+    colourBlocks_.resize((nBlocks_.x > 1 ? 2 : 1) * (nBlocks_.y > 1 ? 2 : 1) * (nBlocks_.z > 1 ? 2 : 1));
+    for (auto x = 0; x < nBlocks_.x; ++x)
+        for (auto y = 0; y < nBlocks_.y; ++y)
+            for (auto z = 0; z < nBlocks_.z; ++z)
+            {
+                auto colour = (nBlocks_.x > 1 ? x % 2 : 0);
+                colour = colour * (nBlocks_.y > 1 ? 2 : 1) + (nBlocks_.y > 1 ? y % 2 : 0);
+                colour = colour * (nBlocks_.z > 1 ? 2 : 1) + (nBlocks_.z > 1 ? z % 2 : 0);
+                colourBlocks_[colour].push_back((x * nBlocks_.y + y) * nBlocks_.z + z);
+            }
+}
+
+/*
+ * Blocks
+ */
+
+// Return number of blocks along each axis
+Vec3<int> CheckerboardDistributor::nBlocks() const { return nBlocks_; }
+
+// Return whether more than one block may be processed at once
+bool CheckerboardDistributor::isConcurrent() const { return blockTargets_.size() > colourBlocks_.size(); }
+
+// Return block index containing the specified Cell
+int CheckerboardDistributor::block(const Cell *cell) const
+{
+    assert(cell);
+
+    const auto &ref = cell->gridReference();
+    const auto divisions = cellArray_.divisions();
+    auto x = ref.x * nBlocks_.x / divisions.x;
+    auto y = ref.y * nBlocks_.y / divisions.y;
+    auto z = ref.z * nBlocks_.z / divisions.z;
+
+    return (x * nBlocks_.y + y) * nBlocks_.z + z;
+}
+
+// Add target object index in the specified Cell
+void CheckerboardDistributor::addTarget(int index, const Cell *cell) { blockTargets_[block(cell)].push_back(index); }
+
+// Return target object indices assigned to the specified block
+const std::vector<int> &CheckerboardDistributor::targets(int blockIndex) const
+{
+    assert(blockIndex >= 0 && blockIndex < blockTargets_.size());
+
+    return blockTargets_[blockIndex];
+}
+
+// Return block indices belonging to each colour
+const std::vector<std::vector<int>> &CheckerboardDistributor::colours() const { return colourBlocks_; }
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/algorithms.h"
+#include "templates/vector3.h"
+#include <vector>
+
+// Forward Declarations
+class Cell;
+class CellArray;
+
+// Checkerboard Distributor
+class CheckerboardDistributor
+{
+    /*
+     * Divides the Cells of a CellArray into cuboid blocks, and colours those blocks (up to eight colours, alternating along
+     * each axis) such that no two blocks of the same colour can interact. Objects (e.g. Molecules) located in blocks of the
+     * same colour may then be modified concurrently by separate threads, with each colour being processed in turn.
+     */
+
+    public:
+    CheckerboardDistributor(const CellArray &cellArray, double modificationRange);
+    ~CheckerboardDistributor() = default;
+
+    /*
+     * Blocks
+     */
+    private:
+    // Source CellArray
+    const CellArray &cellArray_;
+    // Number of blocks along each axis
+    Vec3<int> nBlocks_;
+    // Target object indices assigned to each block
+    std::vector<std::vector<int>> blockTargets_;
+    // Block indices belonging to each colour
+    std::vector<std::vector<int>> colourBlocks_;
+
+    public:
+    // Return number of blocks along each axis
+    Vec3<int> nBlocks() const;
+    // Return whether more than one block may be processed at once
+    bool isConcurrent() const;
+    // Return block index containing the specified Cell
+    int block(const Cell *cell) const;
+    // Add target object index in the specified Cell
+    void addTarget(int index, const Cell *cell);
+    // Return target object indices assigned to the specified block
+    const std::vector<int> &targets(int blockIndex) const;
+    // Return block indices belonging to each colour
+    const std::vector<std::vector<int>> &colours() const;
+
+    /*
+     * Processing
+     */
+    public:
+    // Call the supplied function for each block with its index and targets, processing blocks of the same colour concurrently
+    template <class Lambda> void forEachBlock(Lambda lambda) const
+    {
+        for (const auto &blocks : colourBlocks_)
+            dissolve::for_each(ParallelPolicies::par, blocks.begin(), blocks.end(),
+                               [&](const auto blockIndex) { lambda(blockIndex, blockTargets_[blockIndex]); });
+    }
+};
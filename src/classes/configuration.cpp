@@ -33,6 +33,18 @@ void Configuration::clear()
     requestedCellDivisionLength_ = 7.0;
     contentsVersion_.zero();
 
+    // Reset upkeep
+    spatialReorderFrequency_ = 0;
+
+    // Reset change log
+    changeLogStartVersion_ = -1;
+    changeLogVersion_ = -1;
+    changeLog_.clear();
+    changeLogged_.clear();
+
+    // Invalidate energy cache
+    moleculeEnergyCache_.invalidate();
+
     // Reset definition
     temperature_ = 300.0;
     generator_.clear();
@@ -164,3 +176,34 @@ bool Configuration::setUpProcessPool(const std::vector<int> &worldRanks)
 
 // Return process pool for this Configuration
 ProcessPool &Configuration::processPool() { return processPool_; }
+
+// Broadcast Atom coordinates from the specified root process, updating Cell locations where necessary
+bool Configuration::broadcastCoordinates(ProcessPool &procPool, int rootRank)
+{
+    std::vector<double> x(nAtoms()), y(nAtoms()), z(nAtoms());
+    for (const auto &i : atoms_)
+    {
+        x[i->arrayIndex()] = i->r().x;
+        y[i->arrayIndex()] = i->r().y;
+        z[i->arrayIndex()] = i->r().z;
+    }
+
+    if (!procPool.broadcast(x, rootRank))
+        return false;
+    if (!procPool.broadcast(y, rootRank))
+        return false;
+    if (!procPool.broadcast(z, rootRank))
+        return false;
+
+    // Only Atoms whose coordinates differ from those on the root process need to be updated
+    for (auto &i : atoms_)
+    {
+        Vec3<double> r(x[i->arrayIndex()], y[i->arrayIndex()], z[i->arrayIndex()]);
+        if ((i->r() - r).magnitudeSq() == 0.0)
+            continue;
+        i->setCoordinates(r);
+        updateCellLocation(i.get());
+    }
+
+    return true;
+}
@@ -5,10 +5,12 @@
 
 #include "base/version.h"
 #include "classes/atom.h"
+#include "classes/atomarrays.h"
 #include "classes/atomtypelist.h"
 #include "classes/box.h"
 #include "classes/cellarray.h"
 #include "classes/molecule.h"
+#include "classes/moleculeenergycache.h"
 #include "classes/sitestack.h"
 #include "genericitems/list.h"
 #include "io/import/coordinates.h"
@@ -84,10 +86,18 @@ class Configuration
     AtomTypeList usedAtomTypes_;
     // Contents version, incremented whenever Configuration content or Atom positions change
     VersionCounter contentsVersion_;
+    // Atom index version, incremented whenever the mapping of Atoms to array indices changes
+    VersionCounter atomIndexVersion_;
     // Molecule vector
     std::vector<std::shared_ptr<Molecule>> molecules_;
     // Atom vector
     std::vector<std::shared_ptr<Atom>> atoms_;
+    // Structure-of-arrays mirror of Atom data
+    AtomArrays atomArrays_;
+
+    private:
+    // Update array indices of Molecules and Atoms after removal of content
+    void updateArrayIndices();
 
     public:
     // Empty contents of Configuration, leaving core definitions intact
@@ -118,6 +128,8 @@ class Configuration
     int contentsVersion() const;
     // Increment version of current contents
     void incrementContentsVersion();
+    // Return version of mapping of Atoms to array indices
+    int atomIndexVersion() const;
     // Add Molecule to Configuration based on the supplied Species
     std::shared_ptr<Molecule>
     addMolecule(const Species *sp, OptionalReferenceWrapper<const std::vector<Vec3<double>>> sourceCoordinates = std::nullopt);
@@ -140,8 +152,12 @@ class Configuration
     // Return Atom array
     std::vector<std::shared_ptr<Atom>> &atoms();
     const std::vector<std::shared_ptr<Atom>> &atoms() const;
+    // Return Atoms in Molecule order, which is independent of any spatial reordering of the Atom array
+    std::vector<Atom *> atomsInMoleculeOrder() const;
     // Return nth Atom
     std::shared_ptr<Atom> atom(int n);
+    // Return structure-of-arrays mirror of Atom data
+    const AtomArrays &atomArrays() const;
     // Scale contents of the box by the specified factor
     void scaleContents(double factor);
 
@@ -188,6 +204,10 @@ class Configuration
     /*
      * Upkeep
      */
+    private:
+    // Frequency (in iterations) at which to spatially reorder the Atom array (0 = never)
+    int spatialReorderFrequency_;
+
     public:
     // Update Cell contents
     void updateCellContents();
@@ -195,8 +215,52 @@ class Configuration
     void updateCellLocation(Atom *i);
     // Update Cell location of specified Molecule
     void updateCellLocation(const std::shared_ptr<Molecule> &mol);
-    // Update Cell location of specified Atom indices
-    void updateCellLocation(const std::vector<int> &targetAtoms, int indexOffset);
+    // Update Cell location of specified Atom indices within the supplied Molecule
+    void updateCellLocation(const std::vector<int> &targetAtoms, const std::shared_ptr<Molecule> &mol);
+    // Set frequency (in iterations) at which to spatially reorder the Atom array (0 = never)
+    void setSpatialReorderFrequency(int frequency);
+    // Return frequency (in iterations) at which to spatially reorder the Atom array (0 = never)
+    int spatialReorderFrequency() const;
+    // Reorder Atom array along a space-filling curve through the Cell grid
+    void reorderAtoms();
+
+    /*
+     * Change Log
+     */
+    private:
+    // Contents version at which the change log was started
+    int changeLogStartVersion_;
+    // Contents version up to which all Atom moves have been logged (-1 if no log is active)
+    int changeLogVersion_;
+    // Array indices and original positions of Atoms moved since the change log was started
+    std::vector<std::pair<int, Vec3<double>>> changeLog_;
+    // Flags indicating which Atoms are present in the change log
+    std::vector<bool> changeLogged_;
+
+    public:
+    // Start a new change log from the current contents
+    void resetChangeLog();
+    // Log move of the specified Atom from its original position, if it is not already logged
+    void logAtomMove(int arrayIndex, const Vec3<double> &originalR);
+    // Increment version of current contents, where all Atom moves since the last increment have been logged
+    void incrementContentsVersionLogged();
+    // Return contents version at which the change log was started
+    int changeLogStartVersion() const;
+    // Return whether the change log describes all changes to the contents since it was started
+    bool changeLogValid() const;
+    // Return array indices and original positions of Atoms moved since the change log was started
+    const std::vector<std::pair<int, Vec3<double>>> &changeLog() const;
+
+    /*
+     * Energy Cache
+     */
+    private:
+    // Cached interaction energies of Molecules
+    MoleculeEnergyCache moleculeEnergyCache_;
+
+    public:
+    // Return cached interaction energies of Molecules
+    MoleculeEnergyCache &moleculeEnergyCache();
 
     /*
      * Site Stacks
@@ -230,4 +294,6 @@ class Configuration
     bool setUpProcessPool(const std::vector<int> &worldRanks);
     // Return process pool for this Configuration
     ProcessPool &processPool();
+    // Broadcast Atom coordinates from the specified root process, updating Cell locations where necessary
+    bool broadcastCoordinates(ProcessPool &procPool, int rootRank = 0);
 };
@@ -13,6 +13,7 @@ void Configuration::empty()
 {
     molecules_.clear();
     atoms_.clear();
+    atomArrays_.clear();
     usedAtomTypes_.clear();
     box_ = std::make_unique<CubicBox>(1.0);
     cells_.clear();
@@ -20,6 +21,7 @@ void Configuration::empty()
     speciesPopulations_.clear();
 
     ++contentsVersion_;
+    ++atomIndexVersion_;
 }
 
 // Return specified used type
@@ -88,6 +90,9 @@ int Configuration::contentsVersion() const { return contentsVersion_; }
 // Increment version of current contents
 void Configuration::incrementContentsVersion() { ++contentsVersion_; }
 
+// Return version of mapping of Atoms to array indices
+int Configuration::atomIndexVersion() const { return atomIndexVersion_; }
+
 // Add Molecule to Configuration based on the supplied Species
 std::shared_ptr<Molecule>
 Configuration::addMolecule(const Species *sp, OptionalReferenceWrapper<const std::vector<Vec3<double>>> sourceCoordinates)
@@ -124,7 +129,11 @@ void Configuration::removeMolecules(const Species *sp)
                                         if (mol->species() == sp)
                                         {
                                             for (auto &i : mol->atoms())
+                                            {
+                                                if (i->cell())
+                                                    i->cell()->removeAtom(i.get());
                                                 atoms_.erase(std::find(atoms_.begin(), atoms_.end(), i));
+                                            }
                                             adjustSpeciesPopulation(mol->species(), -1);
                                             return true;
                                         }
@@ -132,6 +141,8 @@ void Configuration::removeMolecules(const Species *sp)
                                             return false;
                                     }),
                      molecules_.end());
+
+    updateArrayIndices();
 }
 
 // Remove specified Molecules from the Configuration
@@ -142,7 +153,11 @@ void Configuration::removeMolecules(const std::vector<std::shared_ptr<Molecule>>
                                         if (std::find(molecules.begin(), molecules.end(), mol) != molecules.end())
                                         {
                                             for (auto &i : mol->atoms())
+                                            {
+                                                if (i->cell())
+                                                    i->cell()->removeAtom(i.get());
                                                 atoms_.erase(std::find(atoms_.begin(), atoms_.end(), i));
+                                            }
                                             adjustSpeciesPopulation(mol->species(), -1);
                                             return true;
                                         }
@@ -150,6 +165,8 @@ void Configuration::removeMolecules(const std::vector<std::shared_ptr<Molecule>>
                                             return false;
                                     }),
                      molecules_.end());
+
+    updateArrayIndices();
 }
 
 // Return number of Molecules in Configuration
@@ -183,6 +200,10 @@ std::shared_ptr<Atom> Configuration::addAtom(const SpeciesAtom *sourceAtom, cons
     newAtom->setLocalTypeIndex(atd.listIndex());
     newAtom->setMasterTypeIndex(sourceAtom->atomType()->index());
 
+    // Mirror the new Atom in our array data
+    atomArrays_.add(*newAtom);
+    ++atomIndexVersion_;
+
     return newAtom;
 }
 
@@ -194,6 +215,18 @@ std::vector<std::shared_ptr<Atom>> &Configuration::atoms() { return atoms_; }
 
 const std::vector<std::shared_ptr<Atom>> &Configuration::atoms() const { return atoms_; }
 
+// Return Atoms in Molecule order, which is independent of any spatial reordering of the Atom array
+std::vector<Atom *> Configuration::atomsInMoleculeOrder() const
+{
+    std::vector<Atom *> orderedAtoms;
+    orderedAtoms.reserve(atoms_.size());
+    for (const auto &mol : molecules_)
+        for (const auto &i : mol->atoms())
+            orderedAtoms.push_back(i.get());
+
+    return orderedAtoms;
+}
+
 // Return nth atom
 std::shared_ptr<Atom> Configuration::atom(int n)
 {
@@ -201,6 +234,24 @@ std::shared_ptr<Atom> Configuration::atom(int n)
     return atoms_[n];
 }
 
+// Return structure-of-arrays mirror of Atom data
+const AtomArrays &Configuration::atomArrays() const { return atomArrays_; }
+
+// Update array indices of Molecules and Atoms after removal of content
+void Configuration::updateArrayIndices()
+{
+    for (auto n = 0; n < molecules_.size(); ++n)
+        molecules_[n]->setArrayIndex(n);
+    for (auto n = 0; n < atoms_.size(); ++n)
+        atoms_[n]->setArrayIndex(n);
+
+    // Indices held by Cells and our array data are now invalid
+    for (auto n = 0; n < cells_.nCells(); ++n)
+        cells_.cell(n)->updateAtomIndices();
+    atomArrays_.update(atoms_);
+    ++atomIndexVersion_;
+}
+
 // Scale contents of the box by the specified factor
 void Configuration::scaleContents(double factor)
 {
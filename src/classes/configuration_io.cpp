@@ -49,14 +49,15 @@ bool Configuration::serialise(LineParser &parser) const
     if ((moleculeCount > 0) && (!parser.writeLineF("{}  '{}'\n", moleculeCount, lastType->name())))
         return false;
 
-    // Write all Atoms - for each write index and coordinates
+    // Write all Atoms (in Molecule order) - for each write index and coordinates
     if (!parser.writeLineF("{}  # nAtoms\n", atoms_.size()))
         return false;
-    for (const auto &i : atoms_)
-    {
-        if (!parser.writeLineF("{} {} {} {}\n", i->molecule()->arrayIndex(), i->x(), i->y(), i->z()))
-            return false;
-    }
+    for (const auto &molecule : molecules_)
+        for (const auto &i : molecule->atoms())
+        {
+            if (!parser.writeLineF("{} {} {} {}\n", molecule->arrayIndex(), i->x(), i->y(), i->z()))
+                return false;
+        }
 
     return true;
 }
@@ -6,6 +6,8 @@
 #include "classes/cell.h"
 #include "classes/changestore.h"
 #include "main/dissolve.h"
+#include <algorithm>
+#include <cstdint>
 
 // Update Cell contents
 void Configuration::updateCellContents()
@@ -19,6 +21,7 @@ void Configuration::updateCellLocation(Atom *i)
 {
     // Fold Atom coordinates into Box
     i->setCoordinates(box_->fold(i->r()));
+    atomArrays_.updateCoordinates(*i);
 
     // Determine new Cell position
     auto *cell = cells_.cell(i->r());
@@ -39,9 +42,120 @@ void Configuration::updateCellLocation(const std::shared_ptr<Molecule> &mol)
         updateCellLocation(mol->atom(n).get());
 }
 
-// Update Cell location of specified Atom indices
-void Configuration::updateCellLocation(const std::vector<int> &targetAtoms, int indexOffset)
+// Update Cell location of specified Atom indices within the supplied Molecule
+void Configuration::updateCellLocation(const std::vector<int> &targetAtoms, const std::shared_ptr<Molecule> &mol)
 {
     for (const auto i : targetAtoms)
-        updateCellLocation(atoms_[i + indexOffset].get());
+        updateCellLocation(mol->atom(i).get());
 }
+
+// Set frequency (in iterations) at which to spatially reorder the Atom array (0 = never)
+void Configuration::setSpatialReorderFrequency(int frequency) { spatialReorderFrequency_ = frequency; }
+
+// Return frequency (in iterations) at which to spatially reorder the Atom array (0 = never)
+int Configuration::spatialReorderFrequency() const { return spatialReorderFrequency_; }
+
+// Reorder Atom array along a space-filling curve through the Cell grid
+void Configuration::reorderAtoms()
+{
+    /*
+     * Sort the Atom array so that Atoms in the same Cell are contiguous, and Cells close in space are close in the array,
+     * by ordering Cells along a Morton (Z-order) curve through their grid references. Array indices of Atoms and the data
+     * depending on them (Cell index lists and AtomArrays) are regenerated. Molecules keep their own Atom order, so
+     * anything working in Molecule order (see atomsInMoleculeOrder()) is unaffected.
+     */
+
+    if (atoms_.empty() || cells_.nCells() == 0)
+        return;
+
+    // Interleave bits of grid reference components to give Morton key for each Cell
+    std::vector<std::uint64_t> cellKeys(cells_.nCells());
+    for (auto n = 0; n < cells_.nCells(); ++n)
+    {
+        const auto &ref = cells_.cell(n)->gridReference();
+        std::uint64_t key = 0;
+        for (auto bit = 0; bit < 21; ++bit)
+            key |= ((std::uint64_t(ref.x >> bit) & 1) << (3 * bit)) | ((std::uint64_t(ref.y >> bit) & 1) << (3 * bit + 1)) |
+                   ((std::uint64_t(ref.z >> bit) & 1) << (3 * bit + 2));
+        cellKeys[n] = key;
+    }
+
+    // Sort Atoms by the key of their Cell, retaining the current relative order of Atoms within each Cell
+    std::vector<std::uint64_t> atomKeys(atoms_.size());
+    for (auto &i : atoms_)
+    {
+        auto *cell = i->cell() ? i->cell() : cells_.cell(i->r());
+        atomKeys[i->arrayIndex()] = cellKeys[cell->index()];
+    }
+    std::stable_sort(atoms_.begin(), atoms_.end(), [&atomKeys](const auto &i, const auto &j) {
+        return atomKeys[i->arrayIndex()] < atomKeys[j->arrayIndex()];
+    });
+
+    // Renumber Atoms, and sort Cell contents so that each Cell maps onto a contiguous range of the Atom array
+    for (auto n = 0; n < atoms_.size(); ++n)
+        atoms_[n]->setArrayIndex(n);
+    for (auto n = 0; n < cells_.nCells(); ++n)
+    {
+        auto &cellAtoms = cells_.cell(n)->atoms();
+        std::sort(cellAtoms.begin(), cellAtoms.end(),
+                  [](const auto *i, const auto *j) { return i->arrayIndex() < j->arrayIndex(); });
+    }
+    updateArrayIndices();
+
+    ++contentsVersion_;
+}
+
+/*
+ * Change Log
+ */
+
+// Start a new change log from the current contents
+void Configuration::resetChangeLog()
+{
+    changeLogStartVersion_ = contentsVersion_;
+    changeLogVersion_ = contentsVersion_;
+    changeLog_.clear();
+    changeLogged_.assign(atoms_.size(), false);
+}
+
+// Log move of the specified Atom from its original position, if it is not already logged
+void Configuration::logAtomMove(int arrayIndex, const Vec3<double> &originalR)
+{
+    // Only log while the log is still describing all changes to the contents
+    if (changeLogVersion_ != contentsVersion_)
+        return;
+
+    assert(arrayIndex >= 0 && arrayIndex < changeLogged_.size());
+    if (changeLogged_[arrayIndex])
+        return;
+
+    changeLogged_[arrayIndex] = true;
+    changeLog_.emplace_back(arrayIndex, originalR);
+}
+
+// Increment version of current contents, where all Atom moves since the last increment have been logged
+void Configuration::incrementContentsVersionLogged()
+{
+    auto logActive = changeLogVersion_ == contentsVersion_;
+
+    ++contentsVersion_;
+
+    if (logActive)
+        changeLogVersion_ = contentsVersion_;
+}
+
+// Return contents version at which the change log was started
+int Configuration::changeLogStartVersion() const { return changeLogStartVersion_; }
+
+// Return whether the change log describes all changes to the contents since it was started
+bool Configuration::changeLogValid() const { return changeLogStartVersion_ != -1 && changeLogVersion_ == contentsVersion_; }
+
+// Return array indices and original positions of Atoms moved since the change log was started
+const std::vector<std::pair<int, Vec3<double>>> &Configuration::changeLog() const { return changeLog_; }
+
+/*
+ * Energy Cache
+ */
+
+// Return cached interaction energies of Molecules
+MoleculeEnergyCache &Configuration::moleculeEnergyCache() { return moleculeEnergyCache_; }
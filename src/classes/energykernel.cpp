@@ -6,9 +6,11 @@
 #include "classes/cell.h"
 #include "classes/configuration.h"
 #include "classes/molecule.h"
+#include "classes/pairblock.h"
 #include "classes/potentialmap.h"
 #include "classes/species.h"
 #include "templates/algorithms.h"
+#include <algorithm>
 #include <iterator>
 #include <numeric>
 
@@ -39,6 +41,16 @@ double EnergyKernel::energyWithMim(const Atom &i, const Atom &j)
     return pairPotentialEnergy(i, j, box_->minimumDistance(j.r(), i.r()));
 }
 
+// Store atoms of the supplied Molecule in the scratch buffer, sorted by Cell index
+void EnergyKernel::sortMoleculeAtoms(const Molecule &mol)
+{
+    moleculeCellAtoms_.clear();
+    for (auto &i : mol.atoms())
+        moleculeCellAtoms_.emplace_back(i->cell()->index(), i.get());
+    std::sort(moleculeCellAtoms_.begin(), moleculeCellAtoms_.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+}
+
 /*
  * PairPotential Terms
  */
@@ -65,64 +77,47 @@ double EnergyKernel::energy(const Cell &centralCell, const Cell &otherCell, bool
 {
     auto totalEnergy = 0.0;
     auto &centralAtoms = centralCell.atoms();
+    auto &centralIndices = centralCell.atomIndices();
     auto &otherAtoms = otherCell.atoms();
-
-    // Loop over central cell atoms
-    if (applyMim)
+    auto &otherIndices = otherCell.atomIndices();
+    const auto &atomArrays = configuration_->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const int nOther = otherIndices.size();
+
+    // Gather other cell atoms into packed blocks, and calculate distances to each central cell atom in bulk
+    PairBlock block(box_, applyMim);
+    for (auto blockStart = 0; blockStart < nOther; blockStart += PairBlock::MaxSize)
     {
-        for (auto &ii : centralAtoms)
-        {
-            auto molI = ii->molecule();
-            auto &rI = ii->r();
-
-            // Straight loop over other cell atoms
-            for (const auto &jj : otherAtoms)
-            {
-                // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-                auto rSq = box_->minimumDistanceSquared(rI, jj->r());
-                if (rSq > cutoffDistanceSquared_)
-                    continue;
+        block.gather(atomArrays, otherIndices.data() + blockStart, std::min(PairBlock::MaxSize, nOther - blockStart));
 
-                // Check for atoms in the same species
-                if (molI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq));
-                else if (!interMolecular)
-                {
-                    double scale = ii->scaling(jj);
-                    if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq)) * scale;
-                }
-            }
-        }
-    }
-    else
-    {
-        for (auto &ii : centralAtoms)
+        // Loop over central cell atoms
+        for (auto n = 0; n < centralIndices.size(); ++n)
         {
-            auto &molI = ii->molecule();
-            auto &rI = ii->r();
+            auto indexI = centralIndices[n];
+            auto molI = molIndices[indexI];
+            const auto *rSq = block.distancesSquared(atomArrays.r(indexI));
 
-            // Straight loop over other cell atoms
-            for (const auto &jj : otherAtoms)
+            // Loop over block atoms, checking squared distances against the stored cutoff distance
+            for (auto m = 0; m < block.size(); ++m)
             {
-                // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-                auto rSq = (rI - jj->r()).magnitudeSq();
-                if (rSq > cutoffDistanceSquared_)
+                if (rSq[m] > cutoffDistanceSquared_)
                     continue;
 
-                // Check for atoms in the same molecule
-                if (molI != jj->molecule())
-                    totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq));
+                auto &j = *otherAtoms[blockStart + m];
 
+                // Check for atoms in the same molecule
+                if (molI != molIndices[otherIndices[blockStart + m]])
+                    totalEnergy += pairPotentialEnergy(*centralAtoms[n], j, sqrt(rSq[m]));
                 else if (!interMolecular)
                 {
-                    double scale = ii->scaling(jj);
+                    double scale = centralAtoms[n]->scaling(&j);
                     if (scale > 1.0e-3)
-                        totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq)) * scale;
+                        totalEnergy += pairPotentialEnergy(*centralAtoms[n], j, sqrt(rSq[m])) * scale;
                 }
             }
         }
     }
+
     return totalEnergy;
 }
 
@@ -131,34 +126,47 @@ double EnergyKernel::energy(const Cell &cell, bool interMolecular)
 {
     auto totalEnergy = 0.0;
     auto &atoms = cell.atoms();
-
-    for (int i = 0; i < atoms.size(); ++i)
+    auto &indices = cell.atomIndices();
+    const auto &atomArrays = configuration_->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const int nAtoms = indices.size();
+
+    // Gather cell atoms into packed blocks, and calculate distances to each preceding atom in bulk
+    PairBlock block(box_, false);
+    for (auto blockStart = 0; blockStart < nAtoms; blockStart += PairBlock::MaxSize)
     {
-        auto &ii = atoms[i];
-        auto molI = ii->molecule();
-        auto &rI = ii->r();
+        block.gather(atomArrays, indices.data() + blockStart, std::min(PairBlock::MaxSize, nAtoms - blockStart));
 
-        // Straight loop over other cell atoms
-        for (int j = i + 1; j < atoms.size(); ++j)
+        for (auto n = 0; n < blockStart + block.size() - 1; ++n)
         {
-            // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-            auto &jj = atoms[j];
+            auto indexI = indices[n];
+            auto molI = molIndices[indexI];
 
-            double rSq = (rI - jj->r()).magnitudeSq();
-            if (rSq > cutoffDistanceSquared_)
-                continue;
+            // Only consider block atoms beyond atom n
+            auto first = std::max(0, n + 1 - blockStart);
+            const auto *rSq = block.distancesSquared(atomArrays.r(indexI), first);
 
-            // Check for atoms in the same molecule
-            if (molI != jj->molecule())
-                totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq));
-            else if (!interMolecular)
+            // Loop over block atoms, checking squared distances against the stored cutoff distance
+            for (auto m = first; m < block.size(); ++m)
             {
-                double scale = ii->scaling(jj);
-                if (scale > 1.0e-3)
-                    totalEnergy += pairPotentialEnergy(*ii, *jj, sqrt(rSq)) * scale;
+                if (rSq[m] > cutoffDistanceSquared_)
+                    continue;
+
+                auto &j = *atoms[blockStart + m];
+
+                // Check for atoms in the same molecule
+                if (molI != molIndices[indices[blockStart + m]])
+                    totalEnergy += pairPotentialEnergy(*atoms[n], j, sqrt(rSq[m]));
+                else if (!interMolecular)
+                {
+                    double scale = atoms[n]->scaling(&j);
+                    if (scale > 1.0e-3)
+                        totalEnergy += pairPotentialEnergy(*atoms[n], j, sqrt(rSq[m])) * scale;
+                }
             }
         }
     }
+
     return totalEnergy;
 }
 
@@ -167,78 +175,89 @@ double EnergyKernel::energy(const Atom &i)
 {
     // Get cell neighbours for atom i's cell
     auto &neighbours = cells_.neighbours(*i.cell());
+    const auto &atomArrays = configuration_->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const auto molI = molIndices[i.arrayIndex()];
 
     return dissolve::transform_reduce(
         ParallelPolicies::par, neighbours.begin(), neighbours.end(), 0.0, std::plus<double>(),
-        [&i, this](const auto &neighbour) {
+        [&i, &atomArrays, molIndices, molI, this](const auto &neighbour) {
             auto mimRequired = neighbour.requiresMIM_;
             auto &nbrCellAtoms = neighbour.neighbour_.atoms();
-            return std::accumulate(
-                nbrCellAtoms.begin(), nbrCellAtoms.end(), 0.0, [&i, mimRequired, this](const auto innerAcc, const auto *j) {
-                    auto &jj = *j;
+            auto &nbrCellIndices = neighbour.neighbour_.atomIndices();
+            auto innerAcc = 0.0;
+            for (auto m = 0; m < nbrCellIndices.size(); ++m)
+            {
+                auto indexJ = nbrCellIndices[m];
 
-                    // Calculate rSquared distance between atoms, and check it against
-                    // the stored cutoff distance
-                    auto rSq = mimRequired ? box_->minimumDistanceSquared(i.r(), jj.r()) : (i.r() - jj.r()).magnitudeSq();
-                    if (rSq > cutoffDistanceSquared_)
-                        return innerAcc;
+                // Check for atoms in the same species
+                if (molI == molIndices[indexJ])
+                    continue;
 
-                    // Check for atoms in the same species
-                    if (i.molecule().get() != jj.molecule().get())
-                        return innerAcc + pairPotentialEnergy(i, jj, sqrt(rSq));
+                // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
+                auto rJ = atomArrays.r(indexJ);
+                auto rSq = mimRequired ? box_->minimumDistanceSquared(i.r(), rJ) : (i.r() - rJ).magnitudeSq();
+                if (rSq > cutoffDistanceSquared_)
+                    continue;
 
-                    return innerAcc;
-                });
+                innerAcc += pairPotentialEnergy(i, *nbrCellAtoms[m], sqrt(rSq));
+            }
+            return innerAcc;
         });
 }
 
 // Return PairPotential energy of Molecule with world
 double EnergyKernel::energy(const Molecule &mol, ProcessPool::DivisionStrategy strategy, bool performSum)
 {
-    // Create a map of atoms in cells so we can treat all atoms with the same set of neighbours at once
-    std::map<Cell *, std::vector<const Atom *>> locationMap;
-    for (auto &i : mol.atoms())
-        locationMap[i->cell()].push_back(i.get());
-
-    auto totalEnergy =
-        std::accumulate(locationMap.begin(), locationMap.end(), 0.0, [&](const auto totalAcc, const auto &location) {
-            const auto &centralCellAtoms = location.second;
-
-            // Get cell neighbours for the cell
-            auto &neighbours = cells_.neighbours(*location.first);
-
-            auto localEnergy = dissolve::transform_reduce(
-                ParallelPolicies::par, neighbours.begin(), neighbours.end(), 0.0, std::plus<double>(),
-                [&centralCellAtoms, this](const auto &neighbour) {
-                    return std::accumulate(
-                        centralCellAtoms.begin(), centralCellAtoms.end(), 0.0,
-                        [&neighbour, this](const auto acc, const auto &i) {
-                            auto &ii = *i;
-                            auto mimRequired = neighbour.requiresMIM_;
-                            auto &nbrCellAtoms = neighbour.neighbour_.atoms();
-                            return acc + std::accumulate(nbrCellAtoms.begin(), nbrCellAtoms.end(), 0.0,
-                                                         [&ii, mimRequired, this](const auto innerAcc, const auto *j) {
-                                                             auto &jj = *j;
-
-                                                             // Calculate rSquared distance between atoms, and check it against
-                                                             // the stored cutoff distance
-                                                             auto rSq = mimRequired
-                                                                            ? box_->minimumDistanceSquared(ii.r(), jj.r())
-                                                                            : (ii.r() - jj.r()).magnitudeSq();
-                                                             if (rSq > cutoffDistanceSquared_)
-                                                                 return innerAcc;
-
-                                                             // Check for atoms in the same species
-                                                             if (ii.molecule().get() != jj.molecule().get())
-                                                                 return innerAcc + pairPotentialEnergy(ii, jj, sqrt(rSq));
-
-                                                             return innerAcc;
-                                                         });
-                        });
-                });
+    // Sort atoms by cell so we can treat all atoms with the same set of neighbours at once
+    sortMoleculeAtoms(mol);
+    const auto &atomArrays = configuration_->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const auto molI = mol.arrayIndex();
 
-            return totalAcc + localEnergy;
-        });
+    auto totalEnergy = 0.0;
+    auto cellBegin = moleculeCellAtoms_.cbegin();
+    while (cellBegin != moleculeCellAtoms_.cend())
+    {
+        auto cellEnd = std::find_if(cellBegin, moleculeCellAtoms_.cend(),
+                                    [cellBegin](const auto &cellAtom) { return cellAtom.first != cellBegin->first; });
+
+        // Get cell neighbours for the cell
+        auto &neighbours = cells_.neighbours(*cellBegin->second->cell());
+
+        totalEnergy += dissolve::transform_reduce(
+            ParallelPolicies::par, neighbours.begin(), neighbours.end(), 0.0, std::plus<double>(),
+            [cellBegin, cellEnd, &atomArrays, molIndices, molI, this](const auto &neighbour) {
+                auto mimRequired = neighbour.requiresMIM_;
+                auto &nbrCellAtoms = neighbour.neighbour_.atoms();
+                auto &nbrCellIndices = neighbour.neighbour_.atomIndices();
+                auto acc = 0.0;
+                for (auto it = cellBegin; it != cellEnd; ++it)
+                {
+                    const auto *i = it->second;
+                    auto &rI = i->r();
+                    for (auto m = 0; m < nbrCellIndices.size(); ++m)
+                    {
+                        auto indexJ = nbrCellIndices[m];
+
+                        // Check for atoms in the same species
+                        if (molI == molIndices[indexJ])
+                            continue;
+
+                        // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
+                        auto rJ = atomArrays.r(indexJ);
+                        auto rSq = mimRequired ? box_->minimumDistanceSquared(rI, rJ) : (rI - rJ).magnitudeSq();
+                        if (rSq > cutoffDistanceSquared_)
+                            continue;
+
+                        acc += pairPotentialEnergy(*i, *nbrCellAtoms[m], sqrt(rSq));
+                    }
+                }
+                return acc;
+            });
+
+        cellBegin = cellEnd;
+    }
 
     // Perform relevant sum if requested
     if (performSum)
@@ -247,6 +266,69 @@ double EnergyKernel::energy(const Molecule &mol, ProcessPool::DivisionStrategy s
     return totalEnergy;
 }
 
+// Return PairPotential energy of Molecule with world, storing contributions from each other Molecule (by array index)
+double EnergyKernel::energy(const Molecule &mol, std::vector<std::pair<int, double>> &moleculeEnergies)
+{
+    sortMoleculeAtoms(mol);
+    const auto &atomArrays = configuration_->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const auto molI = mol.arrayIndex();
+    partnerEnergies_.resize(configuration_->nMolecules(), 0.0);
+
+    // Accumulate pair energies by the Molecule of the second atom
+    auto cellBegin = moleculeCellAtoms_.cbegin();
+    while (cellBegin != moleculeCellAtoms_.cend())
+    {
+        auto cellEnd = std::find_if(cellBegin, moleculeCellAtoms_.cend(),
+                                    [cellBegin](const auto &cellAtom) { return cellAtom.first != cellBegin->first; });
+
+        for (const auto &neighbour : cells_.neighbours(*cellBegin->second->cell()))
+        {
+            auto mimRequired = neighbour.requiresMIM_;
+            auto &nbrCellAtoms = neighbour.neighbour_.atoms();
+            auto &nbrCellIndices = neighbour.neighbour_.atomIndices();
+            for (auto it = cellBegin; it != cellEnd; ++it)
+            {
+                const auto *i = it->second;
+                auto &rI = i->r();
+                for (auto m = 0; m < nbrCellIndices.size(); ++m)
+                {
+                    auto indexJ = nbrCellIndices[m];
+                    auto molJ = molIndices[indexJ];
+                    if (molI == molJ)
+                        continue;
+
+                    auto rJ = atomArrays.r(indexJ);
+                    auto rSq = mimRequired ? box_->minimumDistanceSquared(rI, rJ) : (rI - rJ).magnitudeSq();
+                    if (rSq > cutoffDistanceSquared_)
+                        continue;
+
+                    if (partnerEnergies_[molJ] == 0.0)
+                        partners_.push_back(molJ);
+                    partnerEnergies_[molJ] += pairPotentialEnergy(*i, *nbrCellAtoms[m], sqrt(rSq));
+                }
+            }
+        }
+
+        cellBegin = cellEnd;
+    }
+
+    // Store contributions in order of Molecule index, resetting the scratch space as we go
+    std::sort(partners_.begin(), partners_.end());
+    partners_.erase(std::unique(partners_.begin(), partners_.end()), partners_.end());
+    moleculeEnergies.clear();
+    auto totalEnergy = 0.0;
+    for (auto molJ : partners_)
+    {
+        moleculeEnergies.emplace_back(molJ, partnerEnergies_[molJ]);
+        totalEnergy += partnerEnergies_[molJ];
+        partnerEnergies_[molJ] = 0.0;
+    }
+    partners_.clear();
+
+    return totalEnergy;
+}
+
 // Return molecular correction energy related to intramolecular terms involving supplied atom
 double EnergyKernel::correct(const Atom &i)
 {
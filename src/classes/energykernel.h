@@ -6,6 +6,7 @@
 #include "base/processpool.h"
 #include "classes/kernelflags.h"
 #include <memory>
+#include <vector>
 
 // Forward Declarations
 class Atom;
@@ -45,6 +46,17 @@ class EnergyKernel
     // Squared cutoff distance to use in calculation
     double cutoffDistanceSquared_;
 
+    /*
+     * Scratch Data
+     */
+    private:
+    // Atoms of the current Molecule and the indices of their Cells, sorted by Cell index (reused between calls)
+    std::vector<std::pair<int, const Atom *>> moleculeCellAtoms_;
+    // Interaction energies of the current Molecule with each other Molecule, indexed by array index (reused between calls)
+    std::vector<double> partnerEnergies_;
+    // Array indices of Molecules interacting with the current Molecule
+    std::vector<int> partners_;
+
     /*
      * Internal Routines
      */
@@ -55,6 +67,8 @@ class EnergyKernel
     double energyWithoutMim(const Atom &i, const Atom &j);
     // Return PairPotential energy between atoms provided
     double energyWithMim(const Atom &i, const Atom &j);
+    // Store atoms of the supplied Molecule in the scratch buffer, sorted by Cell index
+    void sortMoleculeAtoms(const Molecule &mol);
 
     /*
      * PairPotential Terms
@@ -68,8 +82,10 @@ class EnergyKernel
     double energy(const Cell &cell, bool interMolecular);
     // Return PairPotential energy of atom with world
     double energy(const Atom &i);
-    // Return PairPotential energy of Molecule with world
+    // Return PairPotential energy of Molecule with world (not safe for concurrent calls on the same kernel)
     double energy(const Molecule &mol, ProcessPool::DivisionStrategy strategy, bool performSum);
+    // Return PairPotential energy of Molecule with world, storing contributions from each other Molecule (by array index)
+    double energy(const Molecule &mol, std::vector<std::pair<int, double>> &moleculeEnergies);
     // Return molecular correction energy related to intramolecular terms involving supplied atom
     double correct(const Atom &i);
     // Return total interatomic PairPotential energy of the system
@@ -8,6 +8,7 @@
 #include "classes/molecule.h"
 #include "classes/potentialmap.h"
 #include "classes/species.h"
+#include "classes/verletlist.h"
 #include "templates/algorithms.h"
 #include <iterator>
 
@@ -18,6 +19,14 @@ ForceKernel::ForceKernel(ProcessPool &procPool, const Box *box, const PotentialM
         (cutoffDistance < 0.0 ? potentialMap_.range() * potentialMap_.range() : cutoffDistance * cutoffDistance);
 }
 
+ForceKernel::ForceKernel(ProcessPool &procPool, const Configuration *cfg, const PotentialMap &potentialMap,
+                         double cutoffDistance)
+    : ForceKernel(procPool, cfg->box(), potentialMap, cutoffDistance)
+{
+    configuration_ = cfg;
+    atomArrays_ = &cfg->atomArrays();
+}
+
 /*
  * Internal Force Calculation
  */
@@ -51,6 +60,31 @@ void ForceKernel::forcesWithMim(const Atom &i, const Atom &j, ForceVector &f, do
     f[j.arrayIndex()] -= force;
 }
 
+// Add inter-particle forces between Atoms provided, given their separation vector and distance
+void ForceKernel::addForces(const Atom &i, const Atom &j, Vec3<double> &vecij, double r, ForceVector &f, double scale) const
+{
+    vecij /= r;
+    vecij *= potentialMap_.force(i, j, r) * scale;
+
+    f[i.arrayIndex()] += vecij;
+    f[j.arrayIndex()] -= vecij;
+}
+
+// Add inter-particle forces between Atoms provided, given their separation vector and distance, and return their energy
+double ForceKernel::addEnergyAndForces(const Atom &i, const Atom &j, Vec3<double> &vecij, double r, ForceVector &f,
+                                       double scale) const
+{
+    auto [u, dU] = potentialMap_.energyAndForce(i, j, r);
+
+    vecij /= r;
+    vecij *= dU * scale;
+
+    f[i.arrayIndex()] += vecij;
+    f[j.arrayIndex()] -= vecij;
+
+    return u * scale;
+}
+
 /*
  * PairPotential Terms
  */
@@ -77,68 +111,84 @@ void ForceKernel::forces(const Cell *centralCell, const Cell *otherCell, bool ap
                          ProcessPool::DivisionStrategy strategy, ForceVector &f) const
 {
     assert(centralCell && otherCell);
+    assert(atomArrays_);
     auto &centralAtoms = centralCell->atoms();
+    auto &centralIndices = centralCell->atomIndices();
     auto &otherAtoms = otherCell->atoms();
-    Vec3<double> rI;
-    std::shared_ptr<Molecule> molI;
+    auto &otherIndices = otherCell->atomIndices();
+    const auto *molIndices = atomArrays_->moleculeIndices();
+    Vec3<double> vecij;
 
     // Get start/stride for specified loop context
     auto offset = processPool_.interleavedLoopStart(strategy);
     auto nChunks = processPool_.interleavedLoopStride(strategy);
+    auto [begin, end] = chop_range(0, int(centralIndices.size()), nChunks, offset);
 
     // Loop over central cell atoms
     if (applyMim)
     {
-        auto [begin, end] = chop_range(centralAtoms.begin(), centralAtoms.end(), nChunks, offset);
-        for (auto indexI = begin; indexI < end; ++indexI)
+        for (auto n = begin; n < end; ++n)
         {
-            auto &ii = *indexI;
-            molI = ii->molecule();
-            rI = ii->r();
+            auto indexI = centralIndices[n];
+            auto molI = molIndices[indexI];
+            auto rI = atomArrays_->r(indexI);
 
             // Straight loop over other cell atoms
-            for (auto &jj : otherAtoms)
+            for (auto m = 0; m < otherIndices.size(); ++m)
             {
+                auto indexJ = otherIndices[m];
+
                 // Check exclusion of I >= J
-                if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
+                if (excludeIgeJ && (indexI >= indexJ))
+                    continue;
+
+                vecij = box_->minimumVector(rI, atomArrays_->r(indexJ));
+                auto rSq = vecij.magnitudeSq();
+                if (rSq > cutoffDistanceSquared_)
                     continue;
 
                 // Check for atoms in the same Molecule
-                if (molI != jj->molecule())
-                    forcesWithMim(*ii, *jj, f);
+                if (molI != molIndices[indexJ])
+                    addForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f);
                 else
                 {
-                    double scale = ii->scaling(jj);
+                    double scale = centralAtoms[n]->scaling(otherAtoms[m]);
                     if (scale > 1.0e-3)
-                        forcesWithMim(*ii, *jj, f, scale);
+                        addForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f, scale);
                 }
             }
         }
     }
     else
     {
-        auto [begin, end] = chop_range(centralCell->atoms().begin(), centralCell->atoms().end(), nChunks, offset);
-        for (auto indexI = begin; indexI < end; ++indexI)
+        for (auto n = begin; n < end; ++n)
         {
-            auto &ii = *indexI;
-            molI = ii->molecule();
-            rI = ii->r();
+            auto indexI = centralIndices[n];
+            auto molI = molIndices[indexI];
+            auto rI = atomArrays_->r(indexI);
 
             // Straight loop over other cell atoms
-            for (auto &jj : otherAtoms)
+            for (auto m = 0; m < otherIndices.size(); ++m)
             {
+                auto indexJ = otherIndices[m];
+
                 // Check exclusion of I >= J
-                if (excludeIgeJ && (ii->arrayIndex() >= jj->arrayIndex()))
+                if (excludeIgeJ && (indexI >= indexJ))
+                    continue;
+
+                vecij = atomArrays_->r(indexJ) - rI;
+                auto rSq = vecij.magnitudeSq();
+                if (rSq > cutoffDistanceSquared_)
                     continue;
 
                 // Check for atoms in the same molecule
-                if (molI != jj->molecule())
-                    forcesWithoutMim(*ii, *jj, f);
+                if (molI != molIndices[indexJ])
+                    addForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f);
                 else
                 {
-                    double scale = ii->scaling(jj);
+                    double scale = centralAtoms[n]->scaling(otherAtoms[m]);
                     if (scale > 1.0e-3)
-                        forcesWithoutMim(*ii, *jj, f, scale);
+                        addForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f, scale);
                 }
             }
         }
@@ -157,6 +207,33 @@ void ForceKernel::forces(const Cell *cell, bool excludeIgeJ, ProcessPool::Divisi
         forces(cell, otherCell, true, excludeIgeJ, strategy, f);
 }
 
+// Calculate forces over all unique cell pairs in the supplied CellArray (half-shell, colour-scheduled)
+void ForceKernel::forces(const CellArray &cellArray, ProcessPool::DivisionStrategy strategy, ForceVector &f) const
+{
+    /*
+     * Each unique Cell pair is visited exactly once, with equal and opposite forces applied to both atoms of each pair.
+     * Pairs are processed colour by colour - since no Cell appears more than once within a colour, the pairs in a colour
+     * write to disjoint sets of atoms and may be computed concurrently straight into the supplied force vector.
+     */
+
+    auto &cellNeighbourPairs = cellArray.getCellNeighbourPairs();
+    auto offset = processPool_.interleavedLoopStart(strategy);
+    auto nChunks = processPool_.interleavedLoopStride(strategy);
+    auto subStrategy = ProcessPool::subDivisionStrategy(strategy);
+
+    for (auto &colour : cellArray.getCellNeighbourPairColours())
+    {
+        auto [begin, end] = chop_range(colour.begin(), colour.end(), nChunks, offset);
+        dissolve::for_each(ParallelPolicies::par, begin, end, [&](const auto pairIndex) {
+            auto &pair = cellNeighbourPairs[pairIndex];
+            if (&pair.master_ == &pair.neighbour_)
+                forces(&pair.master_, &pair.master_, false, true, subStrategy, f);
+            else
+                forces(&pair.master_, &pair.neighbour_, pair.requiresMIM_, false, subStrategy, f);
+        });
+    }
+}
+
 // Calculate forces between Atom and Cell
 void ForceKernel::forces(const Atom &i, const Cell *cell, int flags, ProcessPool::DivisionStrategy strategy,
                          ForceVector &f) const
@@ -352,6 +429,158 @@ void ForceKernel::forces(const Atom &i, ProcessPool::DivisionStrategy strategy,
         forces(i, neighbour, KernelFlags::ApplyMinimumImageFlag, strategy, f);
 }
 
+// Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list
+void ForceKernel::forces(const VerletList &verletList, int indexI, ForceVector &f) const
+{
+    verletForces(verletList, indexI, f);
+}
+
+// Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list, into sparse buffer
+void ForceKernel::forces(const VerletList &verletList, int indexI, SparseForceBuffer &f) const
+{
+    verletForces(verletList, indexI, f);
+}
+
+// Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list
+template <class Forces> void ForceKernel::verletForces(const VerletList &verletList, int indexI, Forces &f) const
+{
+    assert(configuration_ && atomArrays_);
+    const auto &atoms = configuration_->atoms();
+    const auto &neighbours = verletList.neighbours();
+    const auto &scaling = verletList.scaling();
+    auto rI = atomArrays_->r(indexI);
+    Vec3<double> vecij;
+
+    auto [begin, end] = verletList.range(indexI);
+    for (auto n = begin; n < end; ++n)
+    {
+        auto indexJ = neighbours[n];
+        vecij = box_->minimumVector(rI, atomArrays_->r(indexJ));
+        auto rSq = vecij.magnitudeSq();
+        if (rSq > cutoffDistanceSquared_)
+            continue;
+
+        auto r = sqrt(rSq);
+        vecij *= potentialMap_.force(*atoms[indexI], *atoms[indexJ], r) * scaling[n] / r;
+        f[indexI] += vecij;
+        f[indexJ] -= vecij;
+    }
+}
+
+/*
+ * PairPotential Terms (Combined Energy and Forces)
+ */
+
+// Calculate forces between atoms in the supplied cells, returning their energy
+double ForceKernel::energyAndForces(const Cell &centralCell, const Cell &otherCell, bool applyMim, ForceVector &f) const
+{
+    assert(atomArrays_);
+    auto totalEnergy = 0.0;
+    auto &centralAtoms = centralCell.atoms();
+    auto &centralIndices = centralCell.atomIndices();
+    auto &otherAtoms = otherCell.atoms();
+    auto &otherIndices = otherCell.atomIndices();
+    const auto *molIndices = atomArrays_->moleculeIndices();
+    Vec3<double> vecij;
+
+    // Loop over central cell atoms
+    for (auto n = 0; n < centralIndices.size(); ++n)
+    {
+        auto indexI = centralIndices[n];
+        auto molI = molIndices[indexI];
+        auto rI = atomArrays_->r(indexI);
+
+        // Straight loop over other cell atoms
+        for (auto m = 0; m < otherIndices.size(); ++m)
+        {
+            auto indexJ = otherIndices[m];
+
+            vecij = applyMim ? box_->minimumVector(rI, atomArrays_->r(indexJ)) : atomArrays_->r(indexJ) - rI;
+            auto rSq = vecij.magnitudeSq();
+            if (rSq > cutoffDistanceSquared_)
+                continue;
+
+            // Check for atoms in the same molecule
+            if (molI != molIndices[indexJ])
+                totalEnergy += addEnergyAndForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f);
+            else
+            {
+                double scale = centralAtoms[n]->scaling(otherAtoms[m]);
+                if (scale > 1.0e-3)
+                    totalEnergy += addEnergyAndForces(*centralAtoms[n], *otherAtoms[m], vecij, sqrt(rSq), f, scale);
+            }
+        }
+    }
+
+    return totalEnergy;
+}
+
+// Calculate forces between atoms within the supplied cell, returning their energy
+double ForceKernel::energyAndForces(const Cell &cell, ForceVector &f) const
+{
+    assert(atomArrays_);
+    auto totalEnergy = 0.0;
+    auto &atoms = cell.atoms();
+    auto &indices = cell.atomIndices();
+    const auto *molIndices = atomArrays_->moleculeIndices();
+    Vec3<double> vecij;
+
+    for (auto n = 0; n < indices.size(); ++n)
+    {
+        auto indexI = indices[n];
+        auto molI = molIndices[indexI];
+        auto rI = atomArrays_->r(indexI);
+
+        // Loop over remaining atoms in the cell
+        for (auto m = n + 1; m < indices.size(); ++m)
+        {
+            auto indexJ = indices[m];
+
+            vecij = atomArrays_->r(indexJ) - rI;
+            auto rSq = vecij.magnitudeSq();
+            if (rSq > cutoffDistanceSquared_)
+                continue;
+
+            // Check for atoms in the same molecule
+            if (molI != molIndices[indexJ])
+                totalEnergy += addEnergyAndForces(*atoms[n], *atoms[m], vecij, sqrt(rSq), f);
+            else
+            {
+                double scale = atoms[n]->scaling(atoms[m]);
+                if (scale > 1.0e-3)
+                    totalEnergy += addEnergyAndForces(*atoms[n], *atoms[m], vecij, sqrt(rSq), f, scale);
+            }
+        }
+    }
+
+    return totalEnergy;
+}
+
+// Calculate forces over all unique cell pairs in the supplied CellArray (half-shell, colour-scheduled), returning energy
+double ForceKernel::energyAndForces(const CellArray &cellArray, ProcessPool::DivisionStrategy strategy, ForceVector &f) const
+{
+    auto &cellNeighbourPairs = cellArray.getCellNeighbourPairs();
+    auto offset = processPool_.interleavedLoopStart(strategy);
+    auto nChunks = processPool_.interleavedLoopStride(strategy);
+
+    auto energy = 0.0;
+    for (auto &colour : cellArray.getCellNeighbourPairColours())
+    {
+        auto [begin, end] = chop_range(colour.begin(), colour.end(), nChunks, offset);
+        energy += dissolve::transform_reduce(ParallelPolicies::par, begin, end, 0.0, std::plus<double>(),
+                                             [&](const auto pairIndex) {
+                                                 auto &pair = cellNeighbourPairs[pairIndex];
+                                                 if (&pair.master_ == &pair.neighbour_)
+                                                     return energyAndForces(pair.master_, f);
+                                                 else
+                                                     return energyAndForces(pair.master_, pair.neighbour_,
+                                                                            pair.requiresMIM_, f);
+                                             });
+    }
+
+    return energy;
+}
+
 /*
  * Intramolecular Terms
  */
@@ -6,10 +6,12 @@
 #include "base/processpool.h"
 #include "classes/cellarray.h"
 #include "classes/kernelflags.h"
+#include "templates/combinable.h"
 #include <optional>
 
 // Forward Declarations
 class Atom;
+class AtomArrays;
 class Box;
 class Cell;
 class Configuration;
@@ -18,16 +20,20 @@ class SpeciesAngle;
 class SpeciesBond;
 class SpeciesImproper;
 class SpeciesTorsion;
+class VerletList;
 
 // ForceKernel
 class ForceKernel
 {
     public:
     ForceKernel(ProcessPool &procPool, const Box *box, const PotentialMap &potentialMap, double cutoffDistance = -1.0);
+    ForceKernel(ProcessPool &procPool, const Configuration *cfg, const PotentialMap &potentialMap,
+                double cutoffDistance = -1.0);
     ~ForceKernel() = default;
 
     // Alias for force storage vector
     using ForceVector = std::vector<Vec3<double>>;
+    using SparseForceBuffer = dissolve::CombinableBlockedVector<Vec3<double>>::LocalBuffer;
 
     /*
      * Source Data
@@ -35,6 +41,10 @@ class ForceKernel
     protected:
     // Source Box (from Configuration)
     const Box *box_;
+    // Source Configuration (if provided)
+    const Configuration *configuration_{nullptr};
+    // Source Atom arrays (from Configuration, if provided)
+    const AtomArrays *atomArrays_{nullptr};
     // Potential map to use
     const PotentialMap &potentialMap_;
     // Squared cutoff distance to use in calculation
@@ -48,6 +58,13 @@ class ForceKernel
     void forcesWithoutMim(const Atom &i, const Atom &j, ForceVector &f, double scale = 1.00) const;
     // Calculate inter-particle forces between Atoms provided (minimum image calculation)
     void forcesWithMim(const Atom &i, const Atom &j, ForceVector &f, double scale = 1.00) const;
+    // Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list
+    template <class Forces> void verletForces(const VerletList &verletList, int indexI, Forces &f) const;
+    // Add inter-particle forces between Atoms provided, given their (unit) separation vector and distance
+    void addForces(const Atom &i, const Atom &j, Vec3<double> &vecij, double r, ForceVector &f, double scale = 1.00) const;
+    // Add inter-particle forces between Atoms provided, given their separation vector and distance, and return their energy
+    double addEnergyAndForces(const Atom &i, const Atom &j, Vec3<double> &vecij, double r, ForceVector &f,
+                              double scale = 1.00) const;
 
     /*
      * PairPotential Terms
@@ -64,6 +81,23 @@ class ForceKernel
     void forces(const Atom &i, const Cell *cell, int flags, ProcessPool::DivisionStrategy strategy, ForceVector &f) const;
     // Calculate forces between atom and world
     void forces(const Atom &i, ProcessPool::DivisionStrategy strategy, ForceVector &f) const;
+    // Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list
+    void forces(const VerletList &verletList, int indexI, ForceVector &f) const;
+    // Calculate forces between Atom with specified index and its neighbours in the supplied Verlet list, into sparse buffer
+    void forces(const VerletList &verletList, int indexI, SparseForceBuffer &f) const;
+    // Calculate forces over all unique cell pairs in the supplied CellArray (half-shell, colour-scheduled)
+    void forces(const CellArray &cellArray, ProcessPool::DivisionStrategy strategy, ForceVector &f) const;
+
+    /*
+     * PairPotential Terms (Combined Energy and Forces)
+     */
+    public:
+    // Calculate forces between atoms in the supplied cells, returning their energy
+    double energyAndForces(const Cell &centralCell, const Cell &otherCell, bool applyMim, ForceVector &f) const;
+    // Calculate forces between atoms within the supplied cell, returning their energy
+    double energyAndForces(const Cell &cell, ForceVector &f) const;
+    // Calculate forces over all unique cell pairs in the supplied CellArray (half-shell, colour-scheduled), returning energy
+    double energyAndForces(const CellArray &cellArray, ProcessPool::DivisionStrategy strategy, ForceVector &f) const;
 
     struct TorsionParameters
     {
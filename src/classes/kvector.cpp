@@ -25,6 +25,9 @@ void KVector::initialise(int h, int k, int l, int reflectionIndex, int nAtomType
     hkl_.set(h, k, l);
     braggReflectionIndex_ = reflectionIndex;
 
+    // By default we represent ourself and, if not on h == 0, our Friedel mate in the other half-sphere
+    multiplicity_ = (h == 0 ? 1 : 2);
+
     // Create atomtype contribution arrays
     cosTerms_.resize(nAtomTypes, 0);
     sinTerms_.resize(nAtomTypes, 0);
@@ -48,6 +51,12 @@ void KVector::setBraggReflectionIndex(int index) { braggReflectionIndex_ = index
 // Return associated BraggReflection index
 int KVector::braggReflectionIndex() const { return braggReflectionIndex_; }
 
+// Set number of k-vectors over the full sphere represented by this one
+void KVector::setMultiplicity(int multiplicity) { multiplicity_ = multiplicity; }
+
+// Return number of k-vectors over the full sphere represented by this one
+int KVector::multiplicity() const { return multiplicity_; }
+
 // Zero cos/sin term arrays
 void KVector::zeroCosSinTerms()
 {
@@ -65,19 +74,19 @@ void KVector::addSinTerm(int atomTypeIndex, double value) { sinTerms_[atomTypeIn
 void KVector::calculateIntensities(std::vector<BraggReflection> &reflections)
 {
     // Calculate final intensities from stored cos/sin terms
-    // Take account of the half-sphere, doubling intensities of all k-vectors not on h == 0
+    // Take account of the number of k-vectors we represent - by default this doubles intensities of all k-vectors not on
+    // h == 0 to account for the other half-sphere, but may be larger if we represent a set of symmetry-equivalent vectors
     // Do *not* multiply cross-terms (i != j) by 2 - we want to generate the un-multiplied intensity for consistency with
     // other objects
-    auto halfSphereNorm = (hkl_.x == 0 ? 1 : 2);
     auto &braggReflection = reflections[braggReflectionIndex_];
-    braggReflection.addKVectors(halfSphereNorm);
+    braggReflection.addKVectors(multiplicity_);
     for_each_pair(0, cosTerms_.size(), [&](auto i, auto j) {
-        braggReflection.addIntensity(i, j, (cosTerms_[i] * cosTerms_[j] + sinTerms_[i] * sinTerms_[j]) * halfSphereNorm);
+        braggReflection.addIntensity(i, j, (cosTerms_[i] * cosTerms_[j] + sinTerms_[i] * sinTerms_[j]) * multiplicity_);
     });
 }
 
 // Return specified intensity
 double KVector::intensity(int typeI, int typeJ)
 {
-    return (cosTerms_[typeI] * cosTerms_[typeJ] + sinTerms_[typeI] * sinTerms_[typeJ]) * (hkl_.x == 0 ? 1 : 2);
+    return (cosTerms_[typeI] * cosTerms_[typeJ] + sinTerms_[typeI] * sinTerms_[typeJ]) * multiplicity_;
 }
@@ -29,6 +29,8 @@ class KVector
     Vec3<int> hkl_;
     // Associated BraggReflection index
     int braggReflectionIndex_;
+    // Number of k-vectors over the full sphere represented by this one
+    int multiplicity_;
     // Contributions to this k-vector from individual atom types
     std::vector<double> cosTerms_, sinTerms_;
 
@@ -47,6 +49,10 @@ class KVector
     void setBraggReflectionIndex(int index);
     // Return associated BraggReflection index
     int braggReflectionIndex() const;
+    // Set number of k-vectors over the full sphere represented by this one
+    void setMultiplicity(int multiplicity);
+    // Return number of k-vectors over the full sphere represented by this one
+    int multiplicity() const;
     // Zero cos/sin term arrays
     void zeroCosSinTerms();
     // Add value to cosTerm index specified
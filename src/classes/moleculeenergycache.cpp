@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/moleculeenergycache.h"
+#include "classes/configuration.h"
+#include "classes/energykernel.h"
+#include "classes/pairpotential.h"
+#include <algorithm>
+#include <cassert>
+
+/*
+ * Validity
+ */
+
+// Invalidate cached energies
+void MoleculeEnergyCache::invalidate()
+{
+    contentsVersion_ = -1;
+    energies_.clear();
+    contributions_.clear();
+}
+
+// Return whether cached energies are valid for the specified Configuration and cutoff distance
+bool MoleculeEnergyCache::isValid(const Configuration *cfg, double cutoffDistance) const
+{
+    return contentsVersion_ == cfg->contentsVersion() && potentialsVersion_ == PairPotential::tabulationVersion() &&
+           cutoffDistance_ == cutoffDistance && energies_.size() == cfg->nMolecules();
+}
+
+// Set Configuration contents version at which energies are valid, following an external increment
+void MoleculeEnergyCache::setContentsVersion(int version) { contentsVersion_ = version; }
+
+/*
+ * Energies
+ */
+
+// Calculate energies of all Molecules in the specified Configuration
+void MoleculeEnergyCache::calculate(const Configuration *cfg, EnergyKernel &kernel, double cutoffDistance)
+{
+    energies_.resize(cfg->nMolecules());
+    contributions_.resize(cfg->nMolecules());
+    for (auto n = 0; n < cfg->nMolecules(); ++n)
+        energies_[n] = kernel.energy(*cfg->molecules()[n], contributions_[n]);
+
+    contentsVersion_ = cfg->contentsVersion();
+    potentialsVersion_ = PairPotential::tabulationVersion();
+    cutoffDistance_ = cutoffDistance;
+}
+
+// Return cached energy of the specified Molecule
+double MoleculeEnergyCache::energy(int moleculeIndex) const
+{
+    assert(moleculeIndex >= 0 && moleculeIndex < energies_.size());
+
+    return energies_[moleculeIndex];
+}
+
+// Update cached energies following a move of the specified Molecule, given its new contributions from other Molecules
+void MoleculeEnergyCache::update(int moleculeIndex, const std::vector<std::pair<int, double>> &moleculeEnergies)
+{
+    assert(moleculeIndex >= 0 && moleculeIndex < energies_.size());
+
+    auto findContribution = [](auto &contributions, int index) {
+        return std::lower_bound(contributions.begin(), contributions.end(), index,
+                                [](const auto &contribution, int value) { return contribution.first < value; });
+    };
+
+    // Energies are always summed afresh from contributions, so that rounding errors cannot accumulate over many moves
+    auto sumContributions = [&](int index) {
+        energies_[index] = 0.0;
+        for (const auto &contribution : contributions_[index])
+            energies_[index] += contribution.second;
+    };
+
+    // Remove old contributions from the moved Molecule to its previous neighbours
+    for (const auto &[otherIndex, oldEnergy] : contributions_[moleculeIndex])
+    {
+        auto &otherContributions = contributions_[otherIndex];
+        auto it = findContribution(otherContributions, moleculeIndex);
+        if (it != otherContributions.end() && it->first == moleculeIndex)
+            otherContributions.erase(it);
+    }
+
+    // Add new contributions to its current neighbours
+    for (const auto &[otherIndex, newEnergy] : moleculeEnergies)
+    {
+        auto &otherContributions = contributions_[otherIndex];
+        auto it = findContribution(otherContributions, moleculeIndex);
+        if (it != otherContributions.end() && it->first == moleculeIndex)
+            it->second = newEnergy;
+        else
+            otherContributions.insert(it, {moleculeIndex, newEnergy});
+    }
+
+    // Recalculate energies of previous and current neighbours
+    for (const auto &contribution : contributions_[moleculeIndex])
+        sumContributions(contribution.first);
+    for (const auto &contribution : moleculeEnergies)
+        sumContributions(contribution.first);
+
+    // Store new contributions for the moved Molecule
+    contributions_[moleculeIndex] = moleculeEnergies;
+    sumContributions(moleculeIndex);
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+// Forward Declarations
+class Configuration;
+class EnergyKernel;
+
+// Molecule Energy Cache
+class MoleculeEnergyCache
+{
+    /*
+     * Stores the interaction energy of each Molecule in a Configuration with the rest of the system, along with its
+     * contributions from each other Molecule, so that when a Molecule moves the energies of its neighbours can be updated
+     * exactly without recalculation. Cached energies are valid only while the Configuration contents, tabulated pair
+     * potentials, and cutoff distance remain unchanged.
+     */
+
+    public:
+    MoleculeEnergyCache() = default;
+    ~MoleculeEnergyCache() = default;
+
+    /*
+     * Validity
+     */
+    private:
+    // Configuration contents version at which energies are valid (-1 if invalid)
+    int contentsVersion_{-1};
+    // Tabulation version of pair potentials at which energies are valid
+    int potentialsVersion_{-1};
+    // Cutoff distance used in energy calculation
+    double cutoffDistance_{0.0};
+
+    public:
+    // Invalidate cached energies
+    void invalidate();
+    // Return whether cached energies are valid for the specified Configuration and cutoff distance
+    bool isValid(const Configuration *cfg, double cutoffDistance) const;
+    // Set Configuration contents version at which energies are valid, following an external increment
+    void setContentsVersion(int version);
+
+    /*
+     * Energies
+     */
+    private:
+    // Interaction energy of each Molecule
+    std::vector<double> energies_;
+    // Contributions to the energy of each Molecule from other Molecules (by array index, in ascending order)
+    std::vector<std::vector<std::pair<int, double>>> contributions_;
+
+    public:
+    // Calculate energies of all Molecules in the specified Configuration
+    void calculate(const Configuration *cfg, EnergyKernel &kernel, double cutoffDistance);
+    // Return cached energy of the specified Molecule
+    double energy(int moleculeIndex) const;
+    // Update cached energies following a move of the specified Molecule, given its new contributions from other Molecules
+    void update(int moleculeIndex, const std::vector<std::pair<int, double>> &moleculeEnergies);
+};
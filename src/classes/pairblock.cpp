@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/pairblock.h"
+#include "classes/atomarrays.h"
+#include "classes/box.h"
+#include <cassert>
+
+// Build the bulk distance routines for multiple instruction sets (selected at runtime) where the toolchain supports it
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define PAIRBLOCK_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define PAIRBLOCK_MULTIVERSION
+#endif
+
+namespace
+{
+// Calculate squared distances without minimum image
+PAIRBLOCK_MULTIVERSION void distancesSquaredNone(int n, double xI, double yI, double zI, const double *__restrict x,
+                                                 const double *__restrict y, const double *__restrict z,
+                                                 double *__restrict rSq)
+{
+    for (auto m = 0; m < n; ++m)
+    {
+        auto dx = x[m] - xI, dy = y[m] - yI, dz = z[m] - zI;
+        rSq[m] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// Calculate squared distances with minimum image along orthogonal axes
+PAIRBLOCK_MULTIVERSION void distancesSquaredOrthorhombic(int n, double xI, double yI, double zI, const double *__restrict x,
+                                                         const double *__restrict y, const double *__restrict z,
+                                                         const double *lengths, const double *rLengths,
+                                                         double *__restrict rSq)
+{
+    const auto a = lengths[0], b = lengths[1], c = lengths[2];
+    const auto ra = rLengths[0], rb = rLengths[1], rc = rLengths[2];
+    for (auto m = 0; m < n; ++m)
+    {
+        auto dx = x[m] - xI, dy = y[m] - yI, dz = z[m] - zI;
+        dx -= int(dx * ra + (dx < 0.0 ? -0.5 : 0.5)) * a;
+        dy -= int(dy * rb + (dy < 0.0 ? -0.5 : 0.5)) * b;
+        dz -= int(dz * rc + (dz < 0.0 ? -0.5 : 0.5)) * c;
+        rSq[m] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// Calculate squared distances with minimum image via fractional coordinates
+PAIRBLOCK_MULTIVERSION void distancesSquaredGeneral(int n, double xI, double yI, double zI, const double *__restrict x,
+                                                    const double *__restrict y, const double *__restrict z,
+                                                    const double *axes, const double *inverseAxes, double *__restrict rSq)
+{
+    const auto a0 = axes[0], a1 = axes[1], a2 = axes[2], a3 = axes[3], a4 = axes[4], a5 = axes[5], a6 = axes[6],
+               a7 = axes[7], a8 = axes[8];
+    const auto i0 = inverseAxes[0], i1 = inverseAxes[1], i2 = inverseAxes[2], i3 = inverseAxes[3], i4 = inverseAxes[4],
+               i5 = inverseAxes[5], i6 = inverseAxes[6], i7 = inverseAxes[7], i8 = inverseAxes[8];
+    for (auto m = 0; m < n; ++m)
+    {
+        auto dx = x[m] - xI, dy = y[m] - yI, dz = z[m] - zI;
+
+        // Convert to fractional delta and apply minimum image
+        auto fx = dx * i0 + dy * i3 + dz * i6;
+        auto fy = dx * i1 + dy * i4 + dz * i7;
+        auto fz = dx * i2 + dy * i5 + dz * i8;
+        fx -= int(fx + (fx < 0.0 ? -0.5 : 0.5));
+        fy -= int(fy + (fy < 0.0 ? -0.5 : 0.5));
+        fz -= int(fz + (fz < 0.0 ? -0.5 : 0.5));
+
+        // Convert back to real space
+        dx = fx * a0 + fy * a3 + fz * a6;
+        dy = fx * a1 + fy * a4 + fz * a7;
+        dz = fx * a2 + fy * a5 + fz * a8;
+        rSq[m] = dx * dx + dy * dy + dz * dz;
+    }
+}
+} // namespace
+
+PairBlock::PairBlock(const Box *box, bool applyMim)
+{
+    if (!applyMim || box->type() == Box::BoxType::NonPeriodic)
+        mimType_ = MinimumImageType::None;
+    else if (box->type() == Box::BoxType::Cubic || box->type() == Box::BoxType::Orthorhombic)
+    {
+        mimType_ = MinimumImageType::Orthorhombic;
+        for (auto n = 0; n < 3; ++n)
+        {
+            lengths_[n] = box->axisLength(n);
+            rLengths_[n] = 1.0 / lengths_[n];
+        }
+    }
+    else
+    {
+        mimType_ = MinimumImageType::General;
+        for (auto n = 0; n < 9; ++n)
+        {
+            axes_[n] = box->axes().value(n);
+            inverseAxes_[n] = box->inverseAxes().value(n);
+        }
+    }
+}
+
+/*
+ * Block Data
+ */
+
+// Gather coordinates of the specified Atom indices into the block
+void PairBlock::gather(const AtomArrays &atomArrays, const int *indices, int n)
+{
+    assert(n <= MaxSize);
+
+    const auto *x = atomArrays.x();
+    const auto *y = atomArrays.y();
+    const auto *z = atomArrays.z();
+    for (auto m = 0; m < n; ++m)
+    {
+        x_[m] = x[indices[m]];
+        y_[m] = y[indices[m]];
+        z_[m] = z[indices[m]];
+    }
+    size_ = n;
+}
+
+// Calculate squared distances from the supplied coordinate to block atoms from index 'first' onwards
+const double *PairBlock::distancesSquared(const Vec3<double> &rI, int first)
+{
+    auto n = size_ - first;
+    if (n <= 0)
+        return rSq_;
+
+    switch (mimType_)
+    {
+        case (MinimumImageType::None):
+            distancesSquaredNone(n, rI.x, rI.y, rI.z, x_ + first, y_ + first, z_ + first, rSq_ + first);
+            break;
+        case (MinimumImageType::Orthorhombic):
+            distancesSquaredOrthorhombic(n, rI.x, rI.y, rI.z, x_ + first, y_ + first, z_ + first, lengths_, rLengths_,
+                                         rSq_ + first);
+            break;
+        case (MinimumImageType::General):
+            distancesSquaredGeneral(n, rI.x, rI.y, rI.z, x_ + first, y_ + first, z_ + first, axes_, inverseAxes_,
+                                    rSq_ + first);
+            break;
+    }
+
+    return rSq_;
+}
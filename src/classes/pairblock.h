@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+
+// Forward Declarations
+class AtomArrays;
+class Box;
+
+// Pair Block
+class PairBlock
+{
+    /*
+     * Packed block of atomic coordinates gathered from AtomArrays, from which squared distances to a single central atom
+     * are calculated in bulk. The distance routines are written to be vectorised by the compiler and, where supported,
+     * are built for several instruction sets with the best available selected at runtime.
+     */
+
+    public:
+    PairBlock(const Box *box, bool applyMim);
+    ~PairBlock() = default;
+    // Maximum number of atoms in a block
+    static constexpr int MaxSize = 64;
+
+    /*
+     * Minimum Image Data
+     */
+    public:
+    // Minimum Image Type
+    enum class MinimumImageType
+    {
+        None,         /* No minimum image calculation */
+        Orthorhombic, /* Minimum image along orthogonal axes */
+        General       /* Minimum image via fractional coordinates */
+    };
+
+    private:
+    // Minimum image calculation to apply
+    MinimumImageType mimType_;
+    // Axis lengths and their reciprocals (orthorhombic minimum image)
+    double lengths_[3], rLengths_[3];
+    // Axes and inverse axes (general minimum image), column-major
+    double axes_[9], inverseAxes_[9];
+
+    /*
+     * Block Data
+     */
+    private:
+    // Number of atoms in the block
+    int size_{0};
+    // Packed coordinates
+    alignas(64) double x_[MaxSize], y_[MaxSize], z_[MaxSize];
+    // Squared distances from the last calculation
+    alignas(64) double rSq_[MaxSize];
+
+    public:
+    // Gather coordinates of the specified Atom indices into the block
+    void gather(const AtomArrays &atomArrays, const int *indices, int n);
+    // Return number of atoms in the block
+    int size() const { return size_; }
+    // Calculate squared distances from the supplied coordinate to block atoms from index 'first' onwards
+    const double *distancesSquared(const Vec3<double> &rI, int first = 0);
+};
@@ -15,6 +15,7 @@ PairPotential::CoulombTruncationScheme PairPotential::coulombTruncationScheme_ =
 PairPotential::ShortRangeTruncationScheme PairPotential::shortRangeTruncationScheme_ =
     PairPotential::ShiftedShortRangeTruncation;
 double PairPotential::shortRangeTruncationWidth_ = 2.0;
+std::atomic<int> PairPotential::tabulationVersion_{0};
 
 PairPotential::PairPotential() : uFullInterpolation_(uFull_), dUFullInterpolation_(dUFull_) {}
 
@@ -346,6 +347,8 @@ void PairPotential::calculateUFull()
 
     // ...and update its interpolation
     uFullInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
+
+    updateUDUFull();
 }
 
 // Calculate derivative of potential
@@ -385,8 +388,26 @@ void PairPotential::calculateDUFull()
 
     // Update interpolation
     dUFullInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
+
+    updateUDUFull();
+}
+
+// Update interleaved full potential and derivative
+void PairPotential::updateUDUFull()
+{
+    const auto &u = uFull_.values();
+    const auto &dU = dUFull_.values();
+
+    uDUFull_.resize(u.size());
+    for (auto n = 0; n < u.size(); ++n)
+        uDUFull_[n] = {u[n], n < dU.size() ? dU[n] : 0.0};
+
+    ++tabulationVersion_;
 }
 
+// Return version of tabulated potentials, incremented whenever any PairPotential is (re)tabulated
+int PairPotential::tabulationVersion() { return tabulationVersion_; }
+
 // Generate energy and force tables
 bool PairPotential::tabulate(double maxR, double delta, bool includeCoulomb)
 {
@@ -467,9 +488,7 @@ void PairPotential::calculateUOriginal(bool recalculateUFull)
 // Return potential at specified r
 double PairPotential::energy(double r)
 {
-    assert(r >= 0);
-
-    return uFullInterpolation_.y(r, r * rDelta_);
+    return energyAndForce(r).first;
 }
 
 // Return analytic potential at specified r, including Coulomb term from local atomtype charges
@@ -511,9 +530,7 @@ double PairPotential::analyticCoulombEnergy(double qiqj, double r, PairPotential
 // Return derivative at specified r
 double PairPotential::force(double r)
 {
-    assert(r >= 0);
-
-    return dUFullInterpolation_.y(r, r * rDelta_);
+    return energyAndForce(r).second;
 }
 
 // Return analytic force at specified r
@@ -7,7 +7,11 @@
 #include "math/data1d.h"
 #include "math/interpolator.h"
 #include "templates/list.h"
+#include <atomic>
+#include <cassert>
 #include <memory>
+#include <utility>
+#include <vector>
 
 // Forward Declarations
 class AtomType;
@@ -147,6 +151,15 @@ class PairPotential
     Data1D dUFull_;
     // Interpolation of derivative of full potential
     Interpolator dUFullInterpolation_;
+    // Tabulated energy and derivative at a single point
+    struct alignas(16) TabulatedPoint
+    {
+        double u, dU;
+    };
+    // Interleaved full potential and derivative, for direct lookup
+    std::vector<TabulatedPoint> uDUFull_;
+    // Version of tabulated potentials, incremented whenever any PairPotential is (re)tabulated
+    static std::atomic<int> tabulationVersion_;
 
     private:
     // Return analytic short range potential energy
@@ -161,8 +174,12 @@ class PairPotential
     void calculateUFull();
     // Calculate derivative of potential
     void calculateDUFull();
+    // Update interleaved full potential and derivative
+    void updateUDUFull();
 
     public:
+    // Return version of tabulated potentials, incremented whenever any PairPotential is (re)tabulated
+    static int tabulationVersion();
     // Generate energy and force tables
     bool tabulate(double maxR, double delta, bool includeCoulomb);
     // Return number of tabulated points in potential
@@ -185,6 +202,28 @@ class PairPotential
                                  PairPotential::CoulombTruncationScheme truncation = PairPotential::coulombTruncationScheme());
     // Return derivative of potential at specified r
     double force(double r);
+    // Return potential and its derivative at specified r
+    std::pair<double, double> energyAndForce(double r) const
+    {
+        assert(r >= 0.0);
+
+        // Three-point interpolation on the regular grid, indexed directly from r
+        auto x = r * rDelta_;
+        auto index = int(x);
+        if (index >= nPoints_ - 3)
+            return {uDUFull_.back().u, uDUFull_.back().dU};
+
+        auto ppp = x - index;
+        const auto &p0 = uDUFull_[index];
+        const auto &p1 = uDUFull_[index + 1];
+        const auto &p2 = uDUFull_[index + 2];
+        auto u1 = p0.u + (p1.u - p0.u) * ppp;
+        auto u2 = p1.u + (p2.u - p1.u) * (ppp - 1.0);
+        auto dU1 = p0.dU + (p1.dU - p0.dU) * ppp;
+        auto dU2 = p1.dU + (p2.dU - p1.dU) * (ppp - 1.0);
+
+        return {u1 + (u2 - u1) * ppp * 0.5, dU1 + (dU2 - dU1) * ppp * 0.5};
+    }
     // Return analytic force at specified r, including Coulomb term from local atomtype charges
     double analyticForce(double r);
     // Return analytic force at specified r, including Coulomb term from supplied charge product
@@ -84,7 +84,7 @@ double PotentialMap::energy(const Atom &i, const Atom &j, double r) const
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
     auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
-    return pp->energy(r) +
+    return pp->energyAndForce(r).first +
            (pp->includeCoulomb() ? 0 : pp->analyticCoulombEnergy(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r));
 }
 
@@ -97,7 +97,8 @@ double PotentialMap::energy(const SpeciesAtom *i, const SpeciesAtom *j, double r
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
     auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
-    return pp->energy(r) + (pp->includeCoulomb() ? 0 : pp->analyticCoulombEnergy(i->charge() * j->charge(), r));
+    return pp->energyAndForce(r).first +
+           (pp->includeCoulomb() ? 0 : pp->analyticCoulombEnergy(i->charge() * j->charge(), r));
 }
 
 // Return analytic energy between Atom types at distance specified
@@ -119,9 +120,8 @@ double PotentialMap::force(const Atom &i, const Atom &j, double r) const
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
     auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
-    return pp->includeCoulomb()
-               ? pp->force(r)
-               : pp->force(r) + pp->analyticCoulombForce(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r);
+    return pp->energyAndForce(r).second +
+           (pp->includeCoulomb() ? 0 : pp->analyticCoulombForce(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r));
 }
 
 // Return force between SpeciesAtoms at distance specified
@@ -133,7 +133,8 @@ double PotentialMap::force(const SpeciesAtom *i, const SpeciesAtom *j, double r)
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
     auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
-    return pp->includeCoulomb() ? pp->force(r) : pp->force(r) + pp->analyticCoulombForce(i->charge() * j->charge(), r);
+    return pp->energyAndForce(r).second +
+           (pp->includeCoulomb() ? 0 : pp->analyticCoulombForce(i->charge() * j->charge(), r));
 }
 
 // Return analytic force between Atom types at distance specified
@@ -149,3 +150,20 @@ double PotentialMap::analyticForce(const std::shared_ptr<Atom> &i, const std::sh
     return pp->includeCoulomb() ? pp->analyticForce(r)
                                 : pp->analyticForce(i->speciesAtom()->charge() * j->speciesAtom()->charge(), r);
 }
+
+// Return energy and force between Atoms at distance specified
+std::pair<double, double> PotentialMap::energyAndForce(const Atom &i, const Atom &j, double r) const
+{
+    assert(r >= 0.0);
+    assert(i.speciesAtom() && j.speciesAtom());
+
+    // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
+    // interpolated potential
+    auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
+    auto [u, dU] = pp->energyAndForce(r);
+    if (pp->includeCoulomb())
+        return {u, dU};
+
+    auto qiqj = i.speciesAtom()->charge() * j.speciesAtom()->charge();
+    return {u + pp->analyticCoulombEnergy(qiqj, r), dU + pp->analyticCoulombForce(qiqj, r)};
+}
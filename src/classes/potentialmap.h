@@ -55,4 +55,6 @@ class PotentialMap
     double force(const SpeciesAtom *i, const SpeciesAtom *j, double r) const;
     // Return analytic force between Atom types at distance specified
     double analyticForce(const std::shared_ptr<Atom> &i, const std::shared_ptr<Atom> &j, double r) const;
+    // Return energy and force between Atoms at distance specified
+    std::pair<double, double> energyAndForce(const Atom &i, const Atom &j, double r) const;
 };
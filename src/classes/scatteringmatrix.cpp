@@ -9,6 +9,8 @@
 #include "math/svd.h"
 #include "templates/algorithms.h"
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <utility>
 
 ScatteringMatrix::ScatteringMatrix() = default;
@@ -242,46 +244,82 @@ bool ScatteringMatrix::generatePartials(Array2D<Data1D> &estimatedSQ)
     for (auto &n : estimatedSQ)
         n.initialise(data_[0]);
 
-    Array2D<double> inverseA;
     auto qDependentMatrix =
         std::find_if(xRayData_.begin(), xRayData_.end(), [](auto data) { return std::get<0>(data); }) != xRayData_.end();
 
     if (qDependentMatrix)
     {
-        // Generate interpolations for each dataset
-        std::vector<Interpolator> interpolations;
-        interpolations.reserve(data_.size());
-        for (const auto &ref : data_)
-            interpolations.emplace_back(Interpolator(ref));
-
-        // Q-dependent terms in the scattering matrix, so need to invert once at each distinct Q value
         const auto &x = estimatedSQ[0].xAxis();
-        for (auto n = 0; n < x.size(); ++n)
-        {
-            const auto q = x[n];
+        const auto nQ = x.size();
 
-            // Generate inverse matrix at this Q value
-            inverseA = matrix(q);
-            if (!SVD::pseudoinverse(inverseA))
-                return false;
+        // Invalidate the cache if the Q values have changed
+        if (inverseCacheQ_ != x)
+        {
+            inverseCacheQ_ = x;
+            inverseCacheMatrices_.clear();
+            inverseCacheMatrices_.resize(nQ);
+            inverseCache_.clear();
+            inverseCache_.resize(nQ);
+        }
 
-            // Sum in contributions from each dataset at this Q value, provided it is within the range of the dataset
-            for (auto partialIndex = 0; partialIndex < A_.nColumns(); ++partialIndex)
-            {
-                for (auto refDataIndex = 0; refDataIndex < data_.size(); ++refDataIndex)
-                {
-                    if ((q < data_[refDataIndex].xAxis().front()) || (q > data_[refDataIndex].xAxis().back()))
-                        continue;
-                    estimatedSQ[partialIndex].value(n) +=
-                        interpolations[refDataIndex].y(q) * inverseA[{partialIndex, refDataIndex}];
-                }
-            }
+        // Interpolate each dataset onto the target Q values once, flagging points outside the range of the dataset
+        std::vector<std::vector<std::optional<double>>> interpolatedData(data_.size());
+        for (auto refDataIndex = 0; refDataIndex < data_.size(); ++refDataIndex)
+        {
+            const auto &ref = data_[refDataIndex];
+            Interpolator interpolator(ref);
+            auto &values = interpolatedData[refDataIndex];
+            values.resize(nQ);
+            for (auto n = 0; n < nQ; ++n)
+                if ((x[n] >= ref.xAxis().front()) && (x[n] <= ref.xAxis().back()))
+                    values[n] = interpolator.y(x[n]);
         }
+
+        // Grab references to the partial values so that we may write to them concurrently at distinct Q values
+        std::vector<std::reference_wrapper<std::vector<double>>> partialValues;
+        for (auto partialIndex = 0; partialIndex < A_.nColumns(); ++partialIndex)
+            partialValues.emplace_back(estimatedSQ[partialIndex].values());
+
+        // Q-dependent terms in the scattering matrix, so need to invert once at each distinct Q value, reusing any cached
+        // inverse for which the scattering matrix is unchanged
+        std::atomic<bool> inversionFailed = false;
+        std::atomic<int> nInverted = 0;
+        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(nQ),
+                           [&](const auto n) {
+                               auto A = matrix(x[n]);
+                               auto &cachedA = inverseCacheMatrices_[n];
+                               auto &inverseA = inverseCache_[n];
+                               if (cachedA.nRows() != A.nRows() || cachedA.nColumns() != A.nColumns() ||
+                                   !std::equal(A.begin(), A.end(), cachedA.begin()))
+                               {
+                                   inverseA = A;
+                                   if (!SVD::pseudoinverse(inverseA))
+                                   {
+                                       cachedA.clear();
+                                       inversionFailed = true;
+                                       return;
+                                   }
+                                   cachedA = A;
+                                   ++nInverted;
+                               }
+
+                               // Sum in contributions from each dataset at this Q value
+                               for (auto partialIndex = 0; partialIndex < A_.nColumns(); ++partialIndex)
+                                   for (auto refDataIndex = 0; refDataIndex < data_.size(); ++refDataIndex)
+                                       if (interpolatedData[refDataIndex][n])
+                                           partialValues[partialIndex].get()[n] +=
+                                               *interpolatedData[refDataIndex][n] * inverseA[{partialIndex, refDataIndex}];
+                           });
+        if (inversionFailed)
+            return false;
+
+        if (nInverted < nQ)
+            Messenger::print("Reused {} cached inverse scattering matrices (of {}).\n", nQ - nInverted, nQ);
     }
     else
     {
         // No Q-dependent terms in the scattering matrix, so only need to invert once
-        inverseA = A_;
+        auto inverseA = A_;
         if (!SVD::pseudoinverse(inverseA))
             return false;
 
@@ -315,6 +353,7 @@ void ScatteringMatrix::initialise(const std::vector<std::shared_ptr<AtomType>> &
     A_.clear();
     data_.clear();
     typePairs_.clear();
+    xRayData_.clear();
 
     // Copy atom types
     for_each_pair(types.begin(), types.end(), [this](int i, auto at1, int j, auto at2) { typePairs_.emplace_back(at1, at2); });
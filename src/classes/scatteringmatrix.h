@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "classes/xrayweights.h"
 #include "data/formfactors.h"
 #include "data/structurefactors.h"
 #include "math/data1d.h"
@@ -14,7 +15,6 @@
 // Forward Declarations
 class AtomType;
 class NeutronWeights;
-class XRayWeights;
 
 // Scattering Matrix Container
 class ScatteringMatrix
@@ -40,6 +40,10 @@ class ScatteringMatrix
     std::vector<Data1D> data_;
     // X-ray specification for reference data (if relevant)
     std::vector<std::tuple<bool, std::optional<XRayWeights>, StructureFactors::NormalisationType>> xRayData_;
+    // Q values at which cached inverse matrices were generated
+    std::vector<double> inverseCacheQ_;
+    // Cached scattering matrices at each Q value, and their inverses
+    std::vector<Array2D<double>> inverseCacheMatrices_, inverseCache_;
 
     public:
     // Return number of reference AtomType pairs
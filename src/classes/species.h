@@ -13,6 +13,7 @@
 #include "classes/speciessite.h"
 #include "classes/speciestorsion.h"
 #include "io/import/coordinates.h"
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <variant>
@@ -221,6 +222,31 @@ class Species
     // Reduce intramolecular terms to master terms
     void reduceToMasterTerms(CoreData &coreData, bool selectionOnly = false);
 
+    /*
+     * Intramolecular Scaling
+     */
+    private:
+    // Maximum number of atoms for which a scaling matrix will be generated
+    static constexpr int maxScalingMatrixAtoms_ = 10000;
+    // Number of atoms represented in the scaling matrix (zero if not generated)
+    int scalingMatrixSize_{0};
+    // Species version at which the scaling matrix was generated
+    int scalingMatrixVersion_{-1};
+    // Bit matrix of atom pairs whose interactions are fully excluded
+    std::vector<std::uint64_t> excludedPairs_;
+    // Bit matrix of atom pairs whose interactions are scaled
+    std::vector<std::uint64_t> scaledPairs_;
+    // Scale factors for scaled atom pairs, keyed by pair index and sorted
+    std::vector<std::pair<std::uint64_t, double>> scaledPairFactors_;
+
+    public:
+    // Generate scaling matrix from current atom exclusions
+    void generateScalingMatrix();
+    // Return whether the scaling matrix is available and up-to-date
+    bool scalingMatrixValid() const;
+    // Return scaling factor to employ between atoms with the specified indices (requires valid scaling matrix)
+    double scaling(int indexI, int indexJ) const;
+
     /*
      * Box Definition (if any)
      */
@@ -8,6 +8,8 @@
 #include "data/atomicradii.h"
 #include "templates/algorithms.h"
 #include <algorithm>
+#include <cassert>
+#include <map>
 
 /*
  * Public
@@ -666,6 +668,80 @@ void Species::reduceToMasterTerms(CoreData &coreData, bool selectionOnly)
     }
 }
 
+/*
+ * Intramolecular Scaling
+ */
+
+// Generate scaling matrix from current atom exclusions
+void Species::generateScalingMatrix()
+{
+    excludedPairs_.clear();
+    scaledPairs_.clear();
+    scaledPairFactors_.clear();
+    scalingMatrixSize_ = 0;
+
+    const auto nAtoms = int(atoms_.size());
+    if (nAtoms > maxScalingMatrixAtoms_)
+    {
+        Messenger::print("Species '{}' is too large for a precomputed scaling matrix, so exclusions will be searched "
+                         "directly.\n",
+                         name_);
+        return;
+    }
+
+    const auto nWords = (std::uint64_t(nAtoms) * nAtoms + 63) / 64;
+    excludedPairs_.resize(nWords, 0);
+    scaledPairs_.resize(nWords, 0);
+
+    // Determine the effective scale factor for each pair, taking the smallest where the same pair is listed more than once
+    std::map<std::uint64_t, double> pairScaling;
+    for (const auto &i : atoms_)
+        for (const auto &[j, scale] : i.exclusions())
+        {
+            auto key = std::uint64_t(i.index()) * nAtoms + j->index();
+            auto it = pairScaling.find(key);
+            if (it == pairScaling.end())
+                pairScaling[key] = scale;
+            else
+                it->second = std::min(it->second, scale);
+        }
+
+    for (const auto &[key, scale] : pairScaling)
+    {
+        if (scale == 0.0)
+            excludedPairs_[key >> 6] |= std::uint64_t(1) << (key & 63);
+        else
+        {
+            scaledPairs_[key >> 6] |= std::uint64_t(1) << (key & 63);
+            scaledPairFactors_.emplace_back(key, scale);
+        }
+    }
+
+    scalingMatrixSize_ = nAtoms;
+    scalingMatrixVersion_ = version_;
+}
+
+// Return whether the scaling matrix is available and up-to-date
+bool Species::scalingMatrixValid() const { return scalingMatrixSize_ > 0 && scalingMatrixVersion_ == version_; }
+
+// Return scaling factor to employ between atoms with the specified indices (requires valid scaling matrix)
+double Species::scaling(int indexI, int indexJ) const
+{
+    assert(scalingMatrixValid());
+
+    auto key = std::uint64_t(indexI) * scalingMatrixSize_ + indexJ;
+    auto bit = std::uint64_t(1) << (key & 63);
+    if (excludedPairs_[key >> 6] & bit)
+        return 0.0;
+    if (!(scaledPairs_[key >> 6] & bit))
+        return 1.0;
+
+    auto it = std::lower_bound(scaledPairFactors_.begin(), scaledPairFactors_.end(), key,
+                               [](const auto &p, const auto k) { return p.first < k; });
+    assert(it != scaledPairFactors_.end() && it->first == key);
+    return it->second;
+}
+
 // Return periodic box
 const Box *Species::box() const { return box_.get(); }
 
@@ -213,9 +213,16 @@ SpeciesImproper &SpeciesAtom::improper(int index) { return impropers_.at(index);
 // Return array of Impropers in which the Atom is involved
 const std::vector<std::reference_wrapper<SpeciesImproper>> &SpeciesAtom::impropers() const { return impropers_; }
 
+// Return vector of Atoms with scaled or excluded interactions
+const std::vector<std::pair<SpeciesAtom *, double>> &SpeciesAtom::exclusions() const { return exclusions_; }
+
 // Return scaling factor to employ with specified Atom
 double SpeciesAtom::scaling(const SpeciesAtom *j) const
 {
+    // Use the parent Species' precomputed scaling matrix if it is up-to-date
+    if (parent_ && parent_->scalingMatrixValid())
+        return parent_->scaling(index_, j->index_);
+
     auto it = std::find_if(exclusions_.begin(), exclusions_.end(), [j](const auto &p) { return p.first == j; });
     if (it != exclusions_.end())
     {
@@ -33,7 +33,7 @@ class SpeciesAtom
      */
     private:
     // Parent Species
-    Species *parent_;
+    Species *parent_{nullptr};
     // Atomic element
     Elements::Element Z_{Elements::Unknown};
     // Coordinates
@@ -143,6 +143,8 @@ class SpeciesAtom
     SpeciesImproper &improper(int index);
     // Return array of Impropers in which the Atom is involved
     const std::vector<std::reference_wrapper<SpeciesImproper>> &impropers() const;
+    // Return vector of Atoms with scaled or excluded interactions
+    const std::vector<std::pair<SpeciesAtom *, double>> &exclusions() const;
     // Return scaling factor to employ with specified Atom
     double scaling(const SpeciesAtom *j) const;
 
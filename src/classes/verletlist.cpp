@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/verletlist.h"
+#include "classes/atom.h"
+#include "classes/box.h"
+#include "classes/cell.h"
+#include "classes/configuration.h"
+#include "templates/algorithms.h"
+
+VerletList::VerletList(double skin) : skin_(skin) {}
+
+// Clear all data
+void VerletList::clear()
+{
+    cutoff_ = 0.0;
+    contentsVersion_ = -1;
+    atomIndexVersion_ = -1;
+    referenceCoordinates_.clear();
+    offsets_.clear();
+    neighbours_.clear();
+    scaling_.clear();
+}
+
+/*
+ * Control
+ */
+
+// Set skin distance added to the interaction cutoff
+void VerletList::setSkin(double skin)
+{
+    skin_ = skin;
+
+    // Force regeneration on next update
+    clear();
+}
+
+// Return skin distance added to the interaction cutoff
+double VerletList::skin() const { return skin_; }
+
+/*
+ * Neighbour Data
+ */
+
+// Return number of Atoms in the list
+int VerletList::nAtoms() const { return referenceCoordinates_.size(); }
+
+// Return neighbouring Atom indices
+const std::vector<int> &VerletList::neighbours() const { return neighbours_; }
+
+// Return intramolecular scaling factors for each neighbour pair
+const std::vector<double> &VerletList::scaling() const { return scaling_; }
+
+// Return total number of neighbour pairs
+int VerletList::nPairs() const { return neighbours_.size(); }
+
+// Return number of times the list has been generated
+int VerletList::nGenerations() const { return nGenerations_; }
+
+/*
+ * Generation
+ */
+
+// Return whether the list must be regenerated for the supplied Configuration and cutoff
+bool VerletList::requiresRegeneration(const Configuration *cfg, double cutoff) const
+{
+    if (referenceCoordinates_.empty() || referenceCoordinates_.size() != cfg->nAtoms() || cutoff != cutoff_)
+        return true;
+
+    // Stored Atom indices are invalid if the Atoms have been reindexed, and coordinates if the Box has changed
+    if (cfg->atomIndexVersion() != atomIndexVersion_)
+        return true;
+    const auto *box = cfg->box();
+    for (auto n = 0; n < 9; ++n)
+        if (box->axes().value(n) != axes_.value(n))
+            return true;
+
+    // If the contents have changed at all since generation then Atom displacements cannot be trusted
+    if (cfg->contentsVersion() != contentsVersion_)
+        return true;
+
+    // Find the largest displacement of any Atom since the list was generated
+    const auto &atomArrays = cfg->atomArrays();
+    auto maxDeltaSq = dissolve::transform_reduce(
+        ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(cfg->nAtoms()), 0.0,
+        [](const auto a, const auto b) { return std::max(a, b); },
+        [&](const auto index) { return box->minimumDistanceSquared(referenceCoordinates_[index], atomArrays.r(index)); });
+
+    return maxDeltaSq > 0.25 * skin_ * skin_;
+}
+
+// Generate list for the supplied Configuration and cutoff
+void VerletList::generate(const Configuration *cfg, double cutoff)
+{
+    const auto *box = cfg->box();
+    const auto &cells = cfg->cells();
+    const auto &atoms = cfg->atoms();
+    const auto &atomArrays = cfg->atomArrays();
+    const auto *molIndices = atomArrays.moleculeIndices();
+    const auto listRange = cutoff + skin_;
+    const auto listRangeSq = listRange * listRange;
+
+    // The Cell neighbours only cover the pair potential range, so determine those covering the list range
+    auto gridDeltas = cells.neighbourGridDeltas(listRange);
+
+    // Assemble neighbours (j > i) of each Atom, operating over Cells in parallel
+    std::vector<std::vector<int>> atomNeighbours(cfg->nAtoms());
+    std::vector<std::vector<double>> atomScaling(cfg->nAtoms());
+    auto unaryOp = [&](const int id) {
+        const auto *centralCell = cells.cell(id);
+        const auto &gridRef = centralCell->gridReference();
+        std::vector<const Cell *> searchCells{centralCell};
+        for (const auto &delta : gridDeltas)
+            searchCells.push_back(cells.cell(gridRef.x + delta.x, gridRef.y + delta.y, gridRef.z + delta.z));
+
+        for (auto indexI : centralCell->atomIndices())
+        {
+            auto rI = atomArrays.r(indexI);
+            auto molI = molIndices[indexI];
+            auto &nbrs = atomNeighbours[indexI];
+            auto &scales = atomScaling[indexI];
+
+            for (const auto *cell : searchCells)
+                for (auto indexJ : cell->atomIndices())
+                {
+                    if (indexJ <= indexI)
+                        continue;
+
+                    if (box->minimumDistanceSquared(rI, atomArrays.r(indexJ)) > listRangeSq)
+                        continue;
+
+                    // Check for atoms in the same Molecule, discarding pairs which are fully excluded
+                    auto scale = 1.0;
+                    if (molI == molIndices[indexJ])
+                    {
+                        scale = atoms[indexI]->scaling(atoms[indexJ].get());
+                        if (scale < 1.0e-3)
+                            continue;
+                    }
+
+                    nbrs.push_back(indexJ);
+                    scales.push_back(scale);
+                }
+        }
+    };
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                       dissolve::counting_iterator<int>(cells.nCells()), unaryOp);
+
+    // Flatten neighbour data
+    offsets_.resize(cfg->nAtoms() + 1);
+    offsets_[0] = 0;
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+        offsets_[n + 1] = offsets_[n] + atomNeighbours[n].size();
+    neighbours_.resize(offsets_.back());
+    scaling_.resize(offsets_.back());
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+    {
+        std::copy(atomNeighbours[n].begin(), atomNeighbours[n].end(), neighbours_.begin() + offsets_[n]);
+        std::copy(atomScaling[n].begin(), atomScaling[n].end(), scaling_.begin() + offsets_[n]);
+    }
+
+    // Store reference coordinates
+    referenceCoordinates_.resize(cfg->nAtoms());
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+        referenceCoordinates_[n] = atomArrays.r(n);
+
+    cutoff_ = cutoff;
+    contentsVersion_ = cfg->contentsVersion();
+    atomIndexVersion_ = cfg->atomIndexVersion();
+    axes_ = box->axes();
+    ++nGenerations_;
+}
+
+// Regenerate the list if required, returning whether regeneration was performed
+bool VerletList::update(const Configuration *cfg, double cutoff)
+{
+    if (!requiresRegeneration(cfg, cutoff))
+        return false;
+
+    generate(cfg, cutoff);
+
+    return true;
+}
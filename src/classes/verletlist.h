@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "math/matrix3.h"
+#include "templates/vector3.h"
+#include <vector>
+
+// Forward Declarations
+class Configuration;
+
+// Verlet Neighbour List
+class VerletList
+{
+    /*
+     * Half neighbour list of Atom pairs (i < j) lying within the interaction cutoff plus a skin distance, generated from
+     * the Cell structure of a Configuration. The list remains valid, and can be reused, until any Atom has moved more than
+     * half of the skin distance from its position at the point of generation, or the Configuration contents, Atom indexing,
+     * or Box change.
+     */
+
+    public:
+    explicit VerletList(double skin = 0.5);
+    ~VerletList() = default;
+    // Clear all data
+    void clear();
+
+    /*
+     * Control
+     */
+    private:
+    // Skin distance added to the interaction cutoff
+    double skin_;
+
+    public:
+    // Set skin distance added to the interaction cutoff
+    void setSkin(double skin);
+    // Return skin distance added to the interaction cutoff
+    double skin() const;
+
+    /*
+     * Neighbour Data
+     */
+    private:
+    // Interaction cutoff used at the point of generation
+    double cutoff_{0.0};
+    // Configuration contents version at the point of generation
+    int contentsVersion_{-1};
+    // Configuration Atom index version at the point of generation
+    int atomIndexVersion_{-1};
+    // Box axes at the point of generation
+    Matrix3 axes_;
+    // Atom coordinates at the point of generation
+    std::vector<Vec3<double>> referenceCoordinates_;
+    // Offsets into neighbour data for each Atom (size nAtoms + 1)
+    std::vector<int> offsets_;
+    // Indices of neighbouring Atoms
+    std::vector<int> neighbours_;
+    // Intramolecular scaling factors for each neighbour pair
+    std::vector<double> scaling_;
+    // Number of times the list has been generated
+    int nGenerations_{0};
+
+    public:
+    // Return number of Atoms in the list
+    int nAtoms() const;
+    // Return start and end offsets into neighbour data for specified Atom index
+    std::pair<int, int> range(int index) const { return {offsets_[index], offsets_[index + 1]}; }
+    // Return neighbouring Atom indices
+    const std::vector<int> &neighbours() const;
+    // Return intramolecular scaling factors for each neighbour pair
+    const std::vector<double> &scaling() const;
+    // Return total number of neighbour pairs
+    int nPairs() const;
+    // Return number of times the list has been generated
+    int nGenerations() const;
+
+    /*
+     * Generation
+     */
+    public:
+    // Return whether the list must be regenerated for the supplied Configuration and cutoff
+    bool requiresRegeneration(const Configuration *cfg, double cutoff) const;
+    // Generate list for the supplied Configuration and cutoff
+    void generate(const Configuration *cfg, double cutoff);
+    // Regenerate the list if required, returning whether regeneration was performed
+    bool update(const Configuration *cfg, double cutoff);
+};
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "data/sg/spacegroup.h"
+#include "base/messenger.h"
+#include "data/sg/sginfo.h"
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Definition
+ */
+
+// Set spacegroup from its Hermann-Mauguin symbol, Hall symbol, or number, returning false if it is not recognised
+bool Spacegroup::set(std::string_view name)
+{
+    clear();
+
+    // Find the spacegroup in the table - allow for a Hall symbol to be given directly
+    SgError = nullptr;
+    std::string sgName{name};
+    const char *hallSymbol = sgName.c_str();
+    auto *tabSgName = FindTabSgNameEntry(sgName.c_str(), 'A');
+    if (tabSgName)
+        hallSymbol = tabSgName->HallSymbol;
+
+    // Generate the full symmetry information
+    T_SgInfo sgInfo;
+    std::vector<T_RTMx> seitzMatrices(192);
+    std::vector<T_RotMxInfo> rotMxInfo(192);
+    sgInfo.MaxList = 192;
+    sgInfo.ListSeitzMx = seitzMatrices.data();
+    sgInfo.ListRotMxInfo = rotMxInfo.data();
+    InitSgInfo(&sgInfo);
+    sgInfo.TabSgName = tabSgName;
+    ParseHallSymbol(hallSymbol, &sgInfo);
+    if (SgError == nullptr)
+        CompleteSgInfo(&sgInfo);
+    if (SgError != nullptr)
+    {
+        Messenger::error("Failed to set spacegroup from '{}': {}\n", name, SgError);
+        SgError = nullptr;
+        return false;
+    }
+
+    name_ = sgName;
+    for (auto n = 0; n < sgInfo.nList; ++n)
+    {
+        std::array<int, 9> R;
+        std::copy(seitzMatrices[n].s.R, seitzMatrices[n].s.R + 9, R.begin());
+        rotations_.push_back(R);
+    }
+
+    return true;
+}
+
+// Clear spacegroup
+void Spacegroup::clear()
+{
+    name_.clear();
+    rotations_.clear();
+}
+
+// Return whether a spacegroup has been set
+bool Spacegroup::isSet() const { return !rotations_.empty(); }
+
+// Return name of the spacegroup, as supplied
+std::string_view Spacegroup::name() const { return name_; }
+
+// Return number of symmetry operators (excluding lattice translations)
+int Spacegroup::nOperators() const { return rotations_.size(); }
+
+/*
+ * Reflections
+ */
+
+// Return all reflections equivalent to that specified under the Laue group (i.e. including Friedel mates)
+std::vector<Vec3<int>> Spacegroup::equivalentReflections(const Vec3<int> &hkl) const
+{
+    std::vector<Vec3<int>> equivalents{hkl};
+
+    auto addUnique = [&equivalents](int h, int k, int l) {
+        if (std::find_if(equivalents.begin(), equivalents.end(), [h, k, l](const auto &v) {
+                return v.x == h && v.y == k && v.z == l;
+            }) == equivalents.end())
+            equivalents.emplace_back(h, k, l);
+    };
+
+    // Reflections transform as row vectors, i.e. by the transpose of the real-space rotation
+    for (const auto &R : rotations_)
+    {
+        auto h = R[0] * hkl.x + R[3] * hkl.y + R[6] * hkl.z;
+        auto k = R[1] * hkl.x + R[4] * hkl.y + R[7] * hkl.z;
+        auto l = R[2] * hkl.x + R[5] * hkl.y + R[8] * hkl.z;
+        addUnique(h, k, l);
+        addUnique(-h, -k, -l);
+    }
+
+    return equivalents;
+}
+
+// Return whether all operators preserve the metric of the unit cell with the supplied reciprocal axes
+bool Spacegroup::isCompatible(const Vec3<double> &ra, const Vec3<double> &rb, const Vec3<double> &rc, double tolerance) const
+{
+    /*
+     * Operators are defined with respect to the conventional cell of the spacegroup. If the supplied cell is not (a scaled
+     * version of) that cell, some equivalent reflections will not have the same magnitude of Q, which we check through the
+     * reciprocal metric G*, requiring that R G* R^T = G* for every operator R.
+     */
+    const std::array<Vec3<double>, 3> axes = {ra, rb, rc};
+    std::array<double, 9> metric;
+    auto maxElement = 0.0;
+    for (auto i = 0; i < 3; ++i)
+        for (auto j = 0; j < 3; ++j)
+        {
+            metric[i * 3 + j] = axes[i].dp(axes[j]);
+            maxElement = std::max(maxElement, fabs(metric[i * 3 + j]));
+        }
+
+    for (const auto &R : rotations_)
+        for (auto i = 0; i < 3; ++i)
+            for (auto j = 0; j < 3; ++j)
+            {
+                auto x = 0.0;
+                for (auto k = 0; k < 3; ++k)
+                    for (auto l = 0; l < 3; ++l)
+                        x += R[i * 3 + k] * metric[k * 3 + l] * R[j * 3 + l];
+                if (fabs(x - metric[i * 3 + j]) > tolerance * maxElement)
+                    return false;
+            }
+
+    return true;
+}
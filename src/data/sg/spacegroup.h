@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Spacegroup
+class Spacegroup
+{
+    public:
+    Spacegroup() = default;
+    ~Spacegroup() = default;
+
+    /*
+     * Definition
+     */
+    private:
+    // Name of the spacegroup, as supplied
+    std::string name_;
+    // Rotational parts of the symmetry operators (excluding lattice translations)
+    std::vector<std::array<int, 9>> rotations_;
+
+    public:
+    // Set spacegroup from its Hermann-Mauguin symbol, Hall symbol, or number, returning false if it is not recognised
+    bool set(std::string_view name);
+    // Clear spacegroup
+    void clear();
+    // Return whether a spacegroup has been set
+    bool isSet() const;
+    // Return name of the spacegroup, as supplied
+    std::string_view name() const;
+    // Return number of symmetry operators (excluding lattice translations)
+    int nOperators() const;
+
+    /*
+     * Reflections
+     */
+    public:
+    // Return all reflections equivalent to that specified under the Laue group (i.e. including Friedel mates)
+    std::vector<Vec3<int>> equivalentReflections(const Vec3<int> &hkl) const;
+    // Return whether all operators preserve the metric of the unit cell with the supplied reciprocal axes
+    bool isCompatible(const Vec3<double> &ra, const Vec3<double> &rb, const Vec3<double> &rc,
+                      double tolerance = 1.0e-6) const;
+};
@@ -34,7 +34,7 @@ bool CoordinateExportFileFormat::exportXYZ(LineParser &parser, Configuration *cf
         return false;
 
     // Export Atoms
-    for (const auto &i : cfg->atoms())
+    for (const auto *i : cfg->atomsInMoleculeOrder())
         if (!parser.writeLineF("{:<3}   {:15.9f}  {:15.9f}  {:15.9f}\n", Elements::symbol(i->speciesAtom()->Z()), i->r().x,
                                i->r().y, i->r().z))
             return false;
@@ -82,7 +82,7 @@ bool CoordinateExportFileFormat::exportDLPOLY(LineParser &parser, Configuration
 
     // Export Atoms
     auto n = 0;
-    for (const auto &i : cfg->atoms())
+    for (const auto *i : cfg->atomsInMoleculeOrder())
         if (!parser.writeLineF("{:<6}{:10d}{:20.10f}\n{:20.12f}{:20.12f}{:20.12f}\n",
                                cfg->usedAtomType(i->localTypeIndex())->name(), n++ + 1, AtomicMass::mass(i->speciesAtom()->Z()),
                                i->r().x, i->r().y, i->r().z))
@@ -29,7 +29,7 @@ bool TrajectoryExportFileFormat::exportXYZ(LineParser &parser, Configuration *cf
         return false;
 
     // Write Atoms
-    for (const auto &i : cfg->atoms())
+    for (const auto *i : cfg->atomsInMoleculeOrder())
         if (!parser.writeLineF("{:<3}   {:15.9f}  {:15.9f}  {:15.9f}\n", Elements::symbol(i->speciesAtom()->Z()), i->r().x,
                                i->r().y, i->r().z))
             return false;
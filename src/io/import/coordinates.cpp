@@ -107,8 +107,9 @@ bool CoordinateImportFileFormat::importData(LineParser &parser, Configuration *c
             "Number of atoms read from initial coordinates file ({}) does not match that in Configuration ({}).\n", r.size(),
             cfg->nAtoms());
 
-    // All good, so copy atom coordinates over into our array
-    for (auto &&[i, ri] : zip(cfg->atoms(), r))
+    // All good, so copy atom coordinates over into our array (in Molecule order)
+    auto orderedAtoms = cfg->atomsInMoleculeOrder();
+    for (auto &&[i, ri] : zip(orderedAtoms, r))
         i->setCoordinates(ri);
 
     return true;
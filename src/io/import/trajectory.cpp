@@ -41,8 +41,9 @@ bool TrajectoryImportFileFormat::importData(LineParser &parser, Configuration *c
                 fmt::format("Trajectory format '{}' import has not been implemented.\n", formats_.keyword())));
     }
 
-    // All good, so copy atom coordinates over into our array
-    for (auto &&[i, ri] : zip(cfg->atoms(), r))
+    // All good, so copy atom coordinates over into our array (in Molecule order)
+    auto orderedAtoms = cfg->atomsInMoleculeOrder();
+    for (auto &&[i, ri] : zip(orderedAtoms, r))
         i->setCoordinates(ri);
 
     return result;
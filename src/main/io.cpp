@@ -324,6 +324,12 @@ bool Dissolve::saveInput(std::string_view filename)
                                cfg->requestedSizeFactor()))
             return false;
 
+        if (cfg->spatialReorderFrequency() > 0 &&
+            !parser.writeLineF("  {}  {}\n",
+                               ConfigurationBlock::keywords().keyword(ConfigurationBlock::SpatialReorderFrequencyKeyword),
+                               cfg->spatialReorderFrequency()))
+            return false;
+
         if (!parser.writeLineF("{}\n", ConfigurationBlock::keywords().keyword(ConfigurationBlock::EndConfigurationKeyword)))
             return false;
     }
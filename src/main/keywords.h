@@ -48,13 +48,15 @@ namespace ConfigurationBlock
 // Configuration Block Keyword Enum
 enum ConfigurationKeyword
 {
-    CellDivisionLengthKeyword, /* 'CellDivisionLength' - Set the requested side length for regions when partitioning the
-                      unit cell */
-    EndConfigurationKeyword,   /* 'EndConfiguration' - Signals the end of the Configuration block */
-    GeneratorKeyword,          /* 'Generator' - Define the generator procedure for the Configuration */
-    InputCoordinatesKeyword,   /* 'InputCoordinates' - Specifies the file which contains the starting coordinates */
-    SizeFactorKeyword,         /* 'SizeFactor' - Scaling factor for Box lengths, Cell size, and Molecule centres-of-geometry */
-    TemperatureKeyword         /* 'Temperature' - Defines the temperature of the simulation */
+    CellDivisionLengthKeyword,      /* 'CellDivisionLength' - Set the requested side length for regions when partitioning the
+                           unit cell */
+    EndConfigurationKeyword,        /* 'EndConfiguration' - Signals the end of the Configuration block */
+    GeneratorKeyword,               /* 'Generator' - Define the generator procedure for the Configuration */
+    InputCoordinatesKeyword,        /* 'InputCoordinates' - Specifies the file which contains the starting coordinates */
+    SizeFactorKeyword,              /* 'SizeFactor' - Scaling factor for Box lengths, Cell size, and Molecule
+                                       centres-of-geometry */
+    SpatialReorderFrequencyKeyword, /* 'SpatialReorderFrequency' - Frequency at which to reorder atoms spatially by Cell */
+    TemperatureKeyword              /* 'Temperature' - Defines the temperature of the simulation */
 };
 // Return enum option info for ConfigurationKeyword
 EnumOptions<ConfigurationBlock::ConfigurationKeyword> keywords();
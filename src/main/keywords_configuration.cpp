@@ -17,6 +17,7 @@ EnumOptions<ConfigurationBlock::ConfigurationKeyword> ConfigurationBlock::keywor
                                  {ConfigurationBlock::GeneratorKeyword, "Generator"},
                                  {ConfigurationBlock::InputCoordinatesKeyword, "InputCoordinates", 2},
                                  {ConfigurationBlock::SizeFactorKeyword, "SizeFactor", 1},
+                                 {ConfigurationBlock::SpatialReorderFrequencyKeyword, "SpatialReorderFrequency", 1},
                                  {ConfigurationBlock::TemperatureKeyword, "Temperature", 1}});
 }
 
@@ -76,6 +77,9 @@ bool ConfigurationBlock::parse(LineParser &parser, Dissolve *dissolve, Configura
             case (ConfigurationBlock::SizeFactorKeyword):
                 cfg->setRequestedSizeFactor(parser.argd(1));
                 break;
+            case (ConfigurationBlock::SpatialReorderFrequencyKeyword):
+                cfg->setSpatialReorderFrequency(parser.argi(1));
+                break;
             case (ConfigurationBlock::TemperatureKeyword):
                 cfg->setTemperature(parser.argd(1));
                 break;
@@ -33,10 +33,19 @@ bool Dissolve::prepare()
     else
         srand(seed_);
 
-    // Check Species
+    // Initialise seed for counter-based random streams, which must be identical on all processes
+    long int streamSeed = seed_ == -1 ? time(nullptr) : seed_;
+    if (!worldPool().broadcast(streamSeed))
+        return false;
+    worldPool().setRandomStreamSeed(streamSeed);
+
+    // Check Species and generate their intramolecular scaling matrices
     for (const auto &sp : species())
+    {
         if (!sp->checkSetUp())
             return false;
+        sp->generateScalingMatrix();
+    }
 
     // Remove unused atom types
     atomTypes().erase(std::remove_if(atomTypes().begin(), atomTypes().end(),
@@ -197,6 +206,12 @@ bool Dissolve::iterate(int nIterations)
             // Perform any necessary actions before we start processing this Configuration's Modules
             // -- Apply the current size factor
             cfg->applySizeFactor(potentialMap_);
+            // -- Spatially reorder atoms
+            if (cfg->spatialReorderFrequency() > 0 && iteration_ % cfg->spatialReorderFrequency() == 0)
+            {
+                Messenger::print("Reordering atoms by cell location...\n");
+                cfg->reorderAtoms();
+            }
         }
 
         // Sync up all processes
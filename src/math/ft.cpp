@@ -1,52 +1,92 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
 
+#define _USE_MATH_DEFINES
 #include "math/ft.h"
 #include "math/data1d.h"
+#include <algorithm>
+#include <complex>
+#include <math.h>
+#include <numeric>
 
 namespace Fourier
 {
-// Perform Fourier sine transform of current distribution function, over range specified, and with specified broadening
-// function, modification function, and window applied (if requested)
-bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax, WindowFunction windowFunction,
-            const Functions::Function1DWrapper &broadening)
+namespace
 {
-    /*
-     * Perform sine Fourier transform of current data. Function has no notion of forward or backwards transforms -
-     * normalisation and broadening functions must be suitable for the required purpose. Broadening functions are applied to
-     * the transformed function utilising convolution theorem:
-     *
-     * 	f(x) and g(x) are the original functions, while F(q) and G(q) are their Fourier transforms.
-     * 	Pointwise multiplication (.) in one domain equals convolution (*) in the other:
-     *
-     * 	FT[ f(x) * g(x) ] = F(q) . G(q)
-     * 	FT[ f(x) . g(x) ] = F(q) * G(q)
-     *
-     * Since the ultimate goal of this function is to generate the broadened FT of the input data (with the broadening
-     * applied to the transformed data, rather than applied to the input data and then transformed) we require the first
-     * case listed above. The quantity we want is the pointwise multiplication of the FT of the input data with the
-     * broadening functions given, so we can simply perform the convolution of the input data with the *FT* of the
-     * broadening functions, and FT the result.
-     */
+// Minimum number of (x, omega) evaluations for which the fast transform is selected automatically
+constexpr auto fastSineFTThreshold = 16384;
 
-    // Set up window function for the present data
-    windowFunction.setUp(data);
+// Return whether the supplied axis is uniformly spaced
+bool isUniform(const std::vector<double> &x)
+{
+    if (x.size() < 2)
+        return false;
 
-    // Grab x and y arrays
-    const auto &x = data.xAxis();
-    const auto &y = data.values();
+    const auto delta = (x.back() - x.front()) / (x.size() - 1);
+    if (delta <= 0.0)
+        return false;
+
+    for (auto m = 0; m < x.size() - 1; ++m)
+        if (fabs(x[m + 1] - x[m] - delta) > 1.0e-6 * delta)
+            return false;
+
+    return true;
+}
+
+// Perform in-place radix-2 complex FFT of the supplied data, whose size must be a power of two
+void fft(std::vector<std::complex<double>> &data, bool inverse)
+{
+    const int n = data.size();
+
+    // Bit-reversal permutation
+    for (auto i = 1, j = 0; i < n; ++i)
+    {
+        auto bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(data[i], data[j]);
+    }
+
+    // Twiddle factors for the full transform length - each stage uses a strided subset
+    std::vector<std::complex<double>> twiddles(n / 2);
+    for (auto k = 0; k < n / 2; ++k)
+        twiddles[k] = std::polar(1.0, (inverse ? 2.0 : -2.0) * M_PI * k / n);
 
+    // Butterflies
+    for (auto length = 2; length <= n; length <<= 1)
+    {
+        const auto half = length / 2, stride = n / length;
+        for (auto i = 0; i < n; i += length)
+            for (auto k = 0; k < half; ++k)
+            {
+                auto u = data[i + k];
+                auto v = data[i + k + half] * twiddles[k * stride];
+                data[i + k] = u + v;
+                data[i + k + half] = u - v;
+            }
+    }
+
+    if (inverse)
+        for (auto &value : data)
+            value /= n;
+}
+
+// Direct summation of the sine transform at each omega
+std::vector<double> directSineFT(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &omegas,
+                                 const WindowFunction &windowFunction, const Functions::Function1DWrapper &broadening)
+{
     int m;
     const auto nX = x.size();
     double window, broaden;
 
-    // Create working arrays
-    std::vector<double> newX, newY;
+    std::vector<double> newY;
+    newY.reserve(omegas.size());
 
     // Perform Fourier sine transform, apply general and omega-dependent broadening, as well as window function
     double ft, deltaX;
-    double omega = wMin;
-    while (omega <= wMax)
+    for (auto omega : omegas)
     {
         ft = 0.0;
         if (omega > 0.0)
@@ -65,8 +105,7 @@ bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double w
             }
 
             // Normalise w.r.t. omega
-            if (omega > 0.0)
-                ft /= omega;
+            ft /= omega;
         }
         else
         {
@@ -84,13 +123,116 @@ bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double w
             }
         }
 
-        // Add point
-        newX.push_back(omega);
         newY.push_back(ft);
+    }
 
+    return newY;
+}
+
+/*
+ * Fast sine transform on a uniform x grid, valid only for omega-independent window and broadening functions. The weighted
+ * function g(m) = x(m) w(m) b(m) y(m) dx is formed once, and the sum over m of g(m) exp(i x(m) omega(k)) is evaluated for all
+ * k simultaneously as a chirp-z transform. Writing x(m) = x0 + m dx and omega(k) = w0 + k dw, the cross term exp(i m k dx dw)
+ * is split using mk = (m^2 + k^2 - (k-m)^2) / 2, turning the sum into a convolution which is performed by FFT.
+ */
+std::vector<double> fastSineFT(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &omegas,
+                               double wMin, double wStep, const WindowFunction &windowFunction,
+                               const Functions::Function1DWrapper &broadening)
+{
+    const int nTerms = x.size() - 1;
+    const int nOmega = omegas.size();
+    const auto x0 = x.front();
+    const auto deltaX = (x.back() - x.front()) / nTerms;
+    const auto alpha = deltaX * wStep;
+
+    // Calculate omega-independent weighted function
+    std::vector<double> g(nTerms);
+    for (auto m = 0; m < nTerms; ++m)
+        g[m] = x[m] * broadening.yFT(x[m]) * windowFunction.y(x[m], 0.0) * y[m] * (x[m + 1] - x[m]);
+
+    // Set up chirped input and convolution kernel, padded to a power of two
+    auto length = 1;
+    while (length < nTerms + nOmega - 1)
+        length <<= 1;
+    std::vector<std::complex<double>> a(length), b(length);
+    for (auto m = 0; m < nTerms; ++m)
+        a[m] = g[m] * std::polar(1.0, deltaX * wMin * m + 0.5 * alpha * double(m) * m);
+    for (auto n = 0; n < std::max(nTerms, nOmega); ++n)
+    {
+        auto chirp = std::polar(1.0, -0.5 * alpha * double(n) * n);
+        if (n < nOmega)
+            b[n] = chirp;
+        if (n > 0 && n < nTerms)
+            b[length - n] = chirp;
+    }
+
+    // Convolve
+    fft(a, false);
+    fft(b, false);
+    std::transform(a.begin(), a.end(), b.begin(), a.begin(), std::multiplies<>());
+    fft(a, true);
+
+    // Extract sine transform, normalising w.r.t. omega
+    const auto sumG = std::accumulate(g.begin(), g.end(), 0.0);
+    std::vector<double> newY(nOmega);
+    for (auto k = 0; k < nOmega; ++k)
+    {
+        if (omegas[k] > 0.0)
+            newY[k] = (std::polar(1.0, x0 * wMin + x0 * wStep * k + 0.5 * alpha * double(k) * k) * a[k]).imag() / omegas[k];
+        else
+            newY[k] = sumG;
+    }
+
+    return newY;
+}
+} // namespace
+
+// Perform Fourier sine transform of current distribution function, over range specified, and with specified broadening
+// function, modification function, and window applied (if requested)
+bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax, WindowFunction windowFunction,
+            const Functions::Function1DWrapper &broadening, SineFTMethod method)
+{
+    /*
+     * Perform sine Fourier transform of current data. Function has no notion of forward or backwards transforms -
+     * normalisation and broadening functions must be suitable for the required purpose. Broadening functions are applied to
+     * the transformed function utilising convolution theorem:
+     *
+     * 	f(x) and g(x) are the original functions, while F(q) and G(q) are their Fourier transforms.
+     * 	Pointwise multiplication (.) in one domain equals convolution (*) in the other:
+     *
+     * 	FT[ f(x) * g(x) ] = F(q) . G(q)
+     * 	FT[ f(x) . g(x) ] = F(q) * G(q)
+     *
+     * Since the ultimate goal of this function is to generate the broadened FT of the input data (with the broadening
+     * applied to the transformed data, rather than applied to the input data and then transformed) we require the first
+     * case listed above. The quantity we want is the pointwise multiplication of the FT of the input data with the
+     * broadening functions given, so we can simply perform the convolution of the input data with the *FT* of the
+     * broadening functions, and FT the result.
+     */
+
+    // Set up window function for the present data
+    windowFunction.setUp(data);
+
+    // Grab x and y arrays
+    const auto &x = data.xAxis();
+    const auto &y = data.values();
+
+    // Generate omega values
+    std::vector<double> newX;
+    double omega = wMin;
+    while (omega <= wMax)
+    {
+        newX.push_back(omega);
         omega += wStep;
     }
 
+    // Use the fast transform if requested / worthwhile and the data permit it, or the direct sum otherwise
+    auto useFast = method != SineFTMethod::Direct && !broadening.isOmegaDependent() && !newX.empty() && isUniform(x);
+    if (method == SineFTMethod::Auto && (x.size() - 1) * newX.size() < fastSineFTThreshold)
+        useFast = false;
+    auto newY = useFast ? fastSineFT(x, y, newX, wMin, wStep, windowFunction, broadening)
+                        : directSineFT(x, y, newX, windowFunction, broadening);
+
     // Apply normalisation factor
     std::transform(newY.begin(), newY.end(), newY.begin(), [normFactor](auto value) { return value * normFactor; });
 
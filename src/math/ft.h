@@ -12,9 +12,17 @@ class Data1D;
 // Fourier Transforms
 namespace Fourier
 {
+// Sine Transform Methods
+enum class SineFTMethod
+{
+    Auto,   /* Use the fast transform where possible, and the direct sum otherwise */
+    Direct, /* Always use the direct sum */
+    Fast    /* Use the fast transform, falling back to the direct sum if the data are not suitable */
+};
 // Perform Fourier sine transform of supplied data, over range specified, and with specified window and broadening
 // functions applied
 bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax,
             WindowFunction windowFunction = WindowFunction(),
-            const Functions::Function1DWrapper &broadening = Functions::Function1DWrapper());
+            const Functions::Function1DWrapper &broadening = Functions::Function1DWrapper(),
+            SineFTMethod method = SineFTMethod::Auto);
 }; // namespace Fourier
@@ -130,7 +130,7 @@ static std::map<Function1D, FunctionDefinition1D> functions1D_ = {
      */
     {Function1D::OmegaDependentGaussian,
      {{"fwhm(x)"},
-      FunctionProperties::FourierTransform | FunctionProperties::Normalisation,
+      FunctionProperties::FourierTransform | FunctionProperties::Normalisation | FunctionProperties::OmegaDependent,
       [](std::vector<double> p) {
           p.push_back(p[0] / (2.0 * sqrt(2.0 * log(2.0))));
           p.push_back(1.0 / p[1]);
@@ -171,7 +171,7 @@ static std::map<Function1D, FunctionDefinition1D> functions1D_ = {
      */
     {Function1D::GaussianC2,
      {{"fwhm", "fwhm(x)"},
-      FunctionProperties::FourierTransform,
+      FunctionProperties::FourierTransform | FunctionProperties::OmegaDependent,
       [](std::vector<double> p) {
           p.push_back(p[0] / (2.0 * sqrt(2.0 * log(2.0))));
           p.push_back(p[1] / (2.0 * sqrt(2.0 * log(2.0))));
@@ -316,4 +316,7 @@ double Function1DWrapper::normalisation(double omega) const
 {
     return function_.normalisation() ? function_.normalisation()(omega, internalParameters_) : 1.0;
 }
+
+// Return whether the function depends on omega
+bool Function1DWrapper::isOmegaDependent() const { return function_.properties() & FunctionProperties::OmegaDependent; }
 } // namespace Functions
@@ -15,7 +15,8 @@ enum FunctionProperty
 {
     None = 0,
     FourierTransform = 1,
-    Normalisation = 2
+    Normalisation = 2,
+    OmegaDependent = 4
 };
 };
 
@@ -127,5 +128,7 @@ class Function1DWrapper
     double yFT(double x, double omega = 0.0) const;
     // Return normalisation factor at specified omega
     double normalisation(double omega = 0.0) const;
+    // Return whether the function depends on omega
+    bool isOmegaDependent() const;
 };
 } // namespace Functions
@@ -160,6 +160,16 @@ void Histogram1D::add(Histogram1D &other, int factor)
     nMissed_ += other.nMissed_;
 }
 
+// Add supplied counts (one per bin) into local array
+void Histogram1D::addBinCounts(const long int *counts)
+{
+    for (auto n = 0; n < nBins_; ++n)
+    {
+        bins_[n] += counts[n];
+        nBinned_ += counts[n];
+    }
+}
+
 // Return accumulated (averaged) data
 const Data1D &Histogram1D::accumulatedData() const { return accumulatedData_; }
 
@@ -72,6 +72,8 @@ class Histogram1D
     std::vector<long int> &bins();
     // Add source histogram data into local array
     void add(Histogram1D &other, int factor = 1);
+    // Add supplied counts (one per bin) into local array
+    void addBinCounts(const long int *counts);
     // Return accumulated (averaged) data
     const Data1D &accumulatedData() const;
 
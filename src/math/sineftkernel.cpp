@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/sineftkernel.h"
+#include "base/messenger.h"
+#include "math/data1d.h"
+#include "templates/algorithms.h"
+#include <algorithm>
+#include <cmath>
+
+// Clear kernel
+void SineFTKernel::clear()
+{
+    x_.clear();
+    omega_.clear();
+    kernel_.clear();
+}
+
+/*
+ * Kernel Definition
+ */
+
+// Set up kernel for the supplied source data, omega range, and window / broadening functions, returning true if the kernel
+// was (re)generated or false if the existing kernel was still valid
+bool SineFTKernel::setUp(const Data1D &source, double wMin, double wStep, double wMax, WindowFunction windowFunction,
+                         const Functions::Function1DWrapper &broadening)
+{
+    // Is the current kernel still valid?
+    if (!kernel_.empty() && isCompatible(source.xAxis()) && wMin == wMin_ && wStep == wStep_ && wMax == wMax_ &&
+        windowFunction.form() == windowForm_ && broadening.type() == broadeningType_ &&
+        broadening.parameters() == broadeningParameters_)
+        return false;
+
+    x_ = source.xAxis();
+    wMin_ = wMin;
+    wStep_ = wStep;
+    wMax_ = wMax;
+    windowForm_ = windowFunction.form();
+    broadeningType_ = broadening.type();
+    broadeningParameters_ = broadening.parameters();
+
+    // Generate omega values, matching those produced by Fourier::sineFT()
+    omega_.clear();
+    double omega = wMin;
+    while (omega <= wMax)
+    {
+        omega_.push_back(omega);
+        omega += wStep;
+    }
+
+    // Calculate kernel - the final source point does not contribute to the transform
+    windowFunction.setUp(source);
+    const int nTerms = std::max(int(x_.size()) - 1, 0);
+    kernel_.resize(omega_.size() * nTerms);
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                       dissolve::counting_iterator<int>(omega_.size()), [&](const auto index) {
+                           const auto w = omega_[index];
+                           auto *k = &kernel_[index * nTerms];
+                           for (auto m = 0; m < nTerms; ++m)
+                           {
+                               auto factor =
+                                   x_[m] * broadening.yFT(x_[m], w) * windowFunction.y(x_[m], w) * (x_[m + 1] - x_[m]);
+                               k[m] = w > 0.0 ? sin(x_[m] * w) * factor / w : factor;
+                           }
+                       });
+
+    return true;
+}
+
+// Return whether the kernel is valid for the supplied source axis
+bool SineFTKernel::isCompatible(const std::vector<double> &x) const { return x == x_; }
+
+// Return omega values of transformed data
+const std::vector<double> &SineFTKernel::omega() const { return omega_; }
+
+/*
+ * Transform
+ */
+
+// Transform supplied data, dividing blocks of omega values over the processes in the supplied pool (if any)
+bool SineFTKernel::transform(const std::vector<Data1D *> &data, double normFactor, ProcessPool *procPool,
+                             ProcessPool::DivisionStrategy strategy) const
+{
+    if (std::any_of(data.begin(), data.end(), [&](const auto *d) { return !isCompatible(d->xAxis()); }))
+        return Messenger::error("SineFTKernel::transform() - supplied data do not match the kernel's source axis.\n");
+
+    const int nData = data.size();
+    const int nOmega = omega_.size();
+    const int nTerms = std::max(int(x_.size()) - 1, 0);
+
+    // Pack source values so that each x row is contiguous over all datasets
+    std::vector<double> source(nTerms * nData);
+    for (auto n = 0; n < nData; ++n)
+    {
+        const auto &y = data[n]->values();
+        for (auto m = 0; m < nTerms; ++m)
+            source[m * nData + n] = y[m];
+    }
+
+    // Blocked matrix-matrix product of kernel (nOmega x nTerms) with source (nTerms x nData). Blocks of omega rows are
+    // distributed over processes and then threads - each result row is summed in the same order regardless, so the output
+    // does not depend on the division of work.
+    constexpr auto omegaBlockSize = 32, termBlockSize = 256;
+    std::vector<double> result(nOmega * nData, 0.0);
+    const auto nOmegaBlocks = (nOmega + omegaBlockSize - 1) / omegaBlockSize;
+    const auto blockStart = procPool ? procPool->interleavedLoopStart(strategy) : 0;
+    const auto blockStride = procPool ? procPool->interleavedLoopStride(strategy) : 1;
+    std::vector<int> omegaBlocks;
+    for (auto block = blockStart; block < nOmegaBlocks; block += blockStride)
+        omegaBlocks.push_back(block * omegaBlockSize);
+    dissolve::for_each(ParallelPolicies::par, omegaBlocks.begin(), omegaBlocks.end(), [&](const auto wBlock) {
+        const auto wEnd = std::min(wBlock + omegaBlockSize, nOmega);
+        for (auto mBlock = 0; mBlock < nTerms; mBlock += termBlockSize)
+        {
+            const auto mEnd = std::min(mBlock + termBlockSize, nTerms);
+            for (auto w = wBlock; w < wEnd; ++w)
+            {
+                const auto *kernelRow = &kernel_[w * nTerms];
+                auto *resultRow = &result[w * nData];
+                for (auto m = mBlock; m < mEnd; ++m)
+                {
+                    const auto k = kernelRow[m];
+                    const auto *sourceRow = &source[m * nData];
+                    for (auto n = 0; n < nData; ++n)
+                        resultRow[n] += k * sourceRow[n];
+                }
+            }
+        }
+    });
+
+    // Gather results from all processes - rows not calculated on this process are zero
+    if (procPool && !procPool->allSum(result.data(), result.size(), strategy))
+        return false;
+
+    // Unpack results, applying normalisation factor
+    for (auto n = 0; n < nData; ++n)
+    {
+        auto &y = data[n]->values();
+        y.resize(nOmega);
+        for (auto w = 0; w < nOmega; ++w)
+            y[w] = result[w * nData + n] * normFactor;
+        data[n]->xAxis() = omega_;
+    }
+
+    return true;
+}
+
+// Transform supplied data, all of which must share the kernel's source axis, and apply normalisation factor
+bool SineFTKernel::transform(const std::vector<Data1D *> &data, double normFactor) const
+{
+    return transform(data, normFactor, nullptr, ProcessPool::PoolStrategy);
+}
+
+// Transform supplied data in parallel over the specified process pool
+bool SineFTKernel::transform(ProcessPool &procPool, ProcessPool::DivisionStrategy strategy, const std::vector<Data1D *> &data,
+                             double normFactor) const
+{
+    return transform(data, normFactor, &procPool, strategy);
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#pragma once
+
+#include "base/processpool.h"
+#include "math/function1d.h"
+#include "math/windowfunction.h"
+#include <vector>
+
+// Forward Declarations
+class Data1D;
+
+// Sine Fourier Transform Kernel
+class SineFTKernel
+{
+    /*
+     * Precalculated operator for Fourier::sineFT() on a fixed source axis and omega range, including window and broadening
+     * functions, allowing many datasets sharing the same axis to be transformed as a single matrix-matrix product.
+     */
+
+    public:
+    SineFTKernel() = default;
+    ~SineFTKernel() = default;
+    // Clear kernel
+    void clear();
+
+    /*
+     * Kernel Definition
+     */
+    private:
+    // Source axis for which the kernel was generated
+    std::vector<double> x_;
+    // Omega range and resulting values
+    double wMin_{0.0}, wStep_{0.0}, wMax_{0.0};
+    std::vector<double> omega_;
+    // Window function form
+    WindowFunction::Form windowForm_{WindowFunction::Form::None};
+    // Broadening function type and parameters
+    Functions::Function1D broadeningType_{Functions::Function1D::None};
+    std::vector<double> broadeningParameters_;
+    // Kernel matrix (omega rows, x columns)
+    std::vector<double> kernel_;
+
+    public:
+    // Set up kernel for the supplied source data, omega range, and window / broadening functions, returning true if the
+    // kernel was (re)generated or false if the existing kernel was still valid
+    bool setUp(const Data1D &source, double wMin, double wStep, double wMax, WindowFunction windowFunction,
+               const Functions::Function1DWrapper &broadening);
+    // Return whether the kernel is valid for the supplied source axis
+    bool isCompatible(const std::vector<double> &x) const;
+    // Return omega values of transformed data
+    const std::vector<double> &omega() const;
+
+    /*
+     * Transform
+     */
+    private:
+    // Transform supplied data, dividing blocks of omega values over the processes in the supplied pool (if any)
+    bool transform(const std::vector<Data1D *> &data, double normFactor, ProcessPool *procPool,
+                   ProcessPool::DivisionStrategy strategy) const;
+
+    public:
+    // Transform supplied data, all of which must share the kernel's source axis, and apply normalisation factor
+    bool transform(const std::vector<Data1D *> &data, double normFactor) const;
+    // Transform supplied data in parallel over the specified process pool
+    bool transform(ProcessPool &procPool, ProcessPool::DivisionStrategy strategy, const std::vector<Data1D *> &data,
+                   double normFactor) const;
+};
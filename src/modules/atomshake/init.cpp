@@ -8,6 +8,9 @@
 void AtomShakeModule::initialise()
 {
     // Control
+    keywords_.add("Control", new BoolKeyword(false), "Checkerboard",
+                  "Perform moves over threads using a checkerboard decomposition of the cells, rather than distributing "
+                  "molecules over processes");
     keywords_.add("Control", new DoubleKeyword(-1.0, -1.0), "CutoffDistance",
                   "Interatomic cutoff distance to use for energy calculation");
     keywords_.add("Control", new IntegerKeyword(1, 1, 1000), "ShakesPerAtom", "Number of shakes to attempt per atom");
@@ -5,11 +5,13 @@
 #include "base/timer.h"
 #include "classes/box.h"
 #include "classes/changestore.h"
+#include "classes/checkerboarddistributor.h"
 #include "classes/configuration.h"
 #include "classes/energykernel.h"
 #include "classes/regionaldistributor.h"
 #include "main/dissolve.h"
 #include "modules/atomshake/atomshake.h"
+#include <tuple>
 
 // Run main processing
 bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -40,6 +42,7 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto stepSizeMax = keywords_.asDouble("StepSizeMax");
         const auto stepSizeMin = keywords_.asDouble("StepSizeMin");
         const auto termScale = 1.0;
+        const auto checkerboard = keywords_.asBool("Checkerboard");
         const auto rRT = 1.0 / (.008314472 * cfg->temperature());
 
         // Print argument/parameter summary
@@ -48,129 +51,251 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Messenger::print("AtomShake: Step size for adjustments is {:.5f} Angstroms (allowed range is {} <= delta <= {}).\n",
                          stepSize, stepSizeMin, stepSizeMax);
         Messenger::print("AtomShake: Target acceptance rate is {}.\n", targetAcceptanceRate);
+        if (checkerboard)
+            Messenger::print("AtomShake: Moves will be performed over threads using a checkerboard decomposition.\n");
         Messenger::print("\n");
 
-        ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
-
-        // Create a Molecule distributor
-        RegionalDistributor distributor(cfg->nMolecules(), cfg->cells(), procPool, strategy);
-
-        // Create a local ChangeStore and EnergyKernel
-        ChangeStore changeStore(procPool);
+        // Create a suitable EnergyKernel
         EnergyKernel kernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
 
-        // Initialise the random number buffer so it is suitable for our parallel strategy within the main loop
-        procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-
-        int shake, n;
         auto nAttempts = 0, nAccepted = 0;
-        bool accept;
-        double currentEnergy, currentIntraEnergy, newEnergy, newIntraEnergy, delta, totalDelta = 0.0;
-        Vec3<double> rDelta;
+        auto totalDelta = 0.0;
 
         Timer timer;
         procPool.resetAccumulatedTime();
-        while (distributor.cycle())
+        if (checkerboard)
         {
-            // Get next set of Molecule targets from the distributor
-            auto &targetMolecules = distributor.assignedMolecules();
-
-            // Switch parallel strategy if necessary
-            if (distributor.currentStrategy() != strategy)
+            /*
+             * Perform moves with threads over a checkerboard decomposition of the Cells, in which Molecules whose centres
+             * lie in blocks of the same colour cannot interact, and so may have their Atoms moved concurrently. Every process
+             * performs the same moves from the same random numbers, but since threaded energy sums are not reproducible
+             * bit-for-bit the acceptance of moves may differ, so the master's coordinates are broadcast after the sweep.
+             */
+
+            const auto *box = cfg->box();
+
+            // Determine the furthest that any Atom can travel from the Cell containing its Molecule's centre
+            auto maxRadius = 0.0;
+            for (const auto &mol : cfg->molecules())
             {
-                // Set the new strategy
-                strategy = distributor.currentStrategy();
+                auto centre = mol->centreOfGeometry(box);
+                for (const auto &i : mol->atoms())
+                    maxRadius = std::max(maxRadius, box->minimumDistance(centre, i->r()));
+            }
+            const auto maxTravel = nShakesPerAtom * sqrt(3.0) * stepSize;
+
+            // Assign Molecules to blocks according to their centres
+            CheckerboardDistributor checkerboard(cfg->cells(), maxRadius + maxTravel);
+            for (auto molId = 0; molId < cfg->nMolecules(); ++molId)
+                checkerboard.addTarget(molId, cfg->cells().cell(cfg->molecule(molId)->centreOfGeometry(box)));
+            if (!checkerboard.isConcurrent())
+                Messenger::warn("Box is too small for a checkerboard decomposition - moves will be performed serially.\n");
+
+            // Begin a new set of random streams - each block takes its own stream, identical on all processes
+            procPool.nextRandomStreamSet();
+            const auto nBlocks = checkerboard.nBlocks();
+
+            // Store original Atom positions so that moves can be logged in the Configuration
+            std::vector<Vec3<double>> originalR(cfg->nAtoms());
+            for (const auto &i : cfg->atoms())
+                originalR[i->arrayIndex()] = i->r();
+
+            // Shake Atoms in each block, with blocks of the same colour processed concurrently
+            std::vector<std::tuple<int, int, double>> blockStatistics(nBlocks.x * nBlocks.y * nBlocks.z, {0, 0, 0.0});
+            checkerboard.forEachBlock([&](const auto blockIndex, const auto &blockTargets) {
+                auto randomStream = procPool.randomStream(ProcessPool::PoolStrategy, blockIndex);
+                ChangeStore changeStore(procPool, cfg);
+                auto &[blockAttempts, blockAccepted, blockDelta] = blockStatistics[blockIndex];
+                Vec3<double> rDelta;
+
+                for (auto molId : blockTargets)
+                {
+                    auto mol = cfg->molecule(molId);
+                    changeStore.add(mol);
+
+                    for (auto n = 0; n < mol->nAtoms(); ++n)
+                    {
+                        const auto &i = mol->atom(n);
+                        auto currentEnergy = kernel.energy(*i) + kernel.intramolecularEnergy(*mol, *i) * termScale;
 
-                // Re-initialise the random buffer
-                procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+                        for (auto shake = 0; shake < nShakesPerAtom; ++shake)
+                        {
+                            rDelta.set(randomStream.randomPlusMinusOne() * stepSize,
+                                       randomStream.randomPlusMinusOne() * stepSize,
+                                       randomStream.randomPlusMinusOne() * stepSize);
+                            i->translateCoordinates(rDelta);
+                            cfg->updateCellLocation(i.get());
+
+                            // Calculate new energy and trial the move
+                            auto newEnergy = kernel.energy(*i) + kernel.intramolecularEnergy(*mol, *i) * termScale;
+                            auto delta = newEnergy - currentEnergy;
+                            auto accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
+                            if (accept)
+                            {
+                                changeStore.updateAtom(n);
+                                currentEnergy = newEnergy;
+                                blockDelta += delta;
+                                ++blockAccepted;
+                            }
+                            else
+                                changeStore.revert(n);
+                            ++blockAttempts;
+                        }
+                    }
+
+                    changeStore.reset();
+                }
+            });
+
+            // Make the master's coordinates definitive on all processes
+            if (procPool.nProcesses() > 1 && !cfg->broadcastCoordinates(procPool))
+                return false;
+
+            // Log moved Atoms in the Configuration
+            for (const auto &i : cfg->atoms())
+                if ((i->r() - originalR[i->arrayIndex()]).magnitudeSq() > 0.0)
+                    cfg->logAtomMove(i->arrayIndex(), originalR[i->arrayIndex()]);
+
+            // Sum statistics over blocks, taking those of the master (whose coordinates were kept) on all processes
+            for (const auto &[blockAttempts, blockAccepted, blockDelta] : blockStatistics)
+            {
+                nAttempts += blockAttempts;
+                nAccepted += blockAccepted;
+                totalDelta += blockDelta;
+            }
+            if (procPool.nProcesses() > 1)
+            {
+                if (!procPool.broadcast(nAttempts))
+                    return false;
+                if (!procPool.broadcast(nAccepted))
+                    return false;
+                if (!procPool.broadcast(totalDelta))
+                    return false;
             }
+        }
+        else
+        {
+            ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
+
+            // Create a Molecule distributor
+            RegionalDistributor distributor(cfg->nMolecules(), cfg->cells(), procPool, strategy);
+
+            // Create a local ChangeStore
+            ChangeStore changeStore(procPool, cfg);
+
+            // Begin a new set of random streams, and get one suitable for our parallel strategy
+            procPool.nextRandomStreamSet();
+            auto randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
+
+            int shake, n;
+            bool accept;
+            double currentEnergy, currentIntraEnergy, newEnergy, newIntraEnergy, delta;
+            Vec3<double> rDelta;
 
-            // Loop over target Molecules
-            for (auto molId : targetMolecules)
+            while (distributor.cycle())
             {
-                /*
-                 * Calculation Begins
-                 */
+                // Get next set of Molecule targets from the distributor
+                auto &targetMolecules = distributor.assignedMolecules();
 
-                // Get Molecule index and pointer
-                std::shared_ptr<Molecule> mol = cfg->molecule(molId);
+                // Switch parallel strategy if necessary
+                if (distributor.currentStrategy() != strategy)
+                {
+                    // Set the new strategy
+                    strategy = distributor.currentStrategy();
 
-                // Set current Atom targets in ChangeStore (whole Molecule)
-                changeStore.add(mol);
+                    // Get a new random stream
+                    procPool.nextRandomStreamSet();
+                    randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
+                }
 
-                n = 0;
-                // Loop over atoms in the Molecule
-                for (const auto &i : mol->atoms())
+                // Loop over target Molecules
+                for (auto molId : targetMolecules)
                 {
-                    // Calculate reference energy for the Atom
-                    currentEnergy = kernel.energy(*i);
-                    currentIntraEnergy = kernel.intramolecularEnergy(*mol, *i) * termScale;
+                    /*
+                     * Calculation Begins
+                     */
+
+                    // Get Molecule index and pointer
+                    std::shared_ptr<Molecule> mol = cfg->molecule(molId);
+
+                    // Set current Atom targets in ChangeStore (whole Molecule)
+                    changeStore.add(mol);
 
-                    // Loop over number of shakes per Atom
-                    for (shake = 0; shake < nShakesPerAtom; ++shake)
+                    n = 0;
+                    // Loop over atoms in the Molecule
+                    for (const auto &i : mol->atoms())
                     {
-                        // Create a random translation vector
-                        rDelta.set(procPool.randomPlusMinusOne() * stepSize, procPool.randomPlusMinusOne() * stepSize,
-                                   procPool.randomPlusMinusOne() * stepSize);
+                        // Calculate reference energy for the Atom
+                        currentEnergy = kernel.energy(*i);
+                        currentIntraEnergy = kernel.intramolecularEnergy(*mol, *i) * termScale;
 
-                        // Translate Atom and update its Cell position
-                        i->translateCoordinates(rDelta);
-                        cfg->updateCellLocation(i.get());
+                        // Loop over number of shakes per Atom
+                        for (shake = 0; shake < nShakesPerAtom; ++shake)
+                        {
+                            // Create a random translation vector
+                            rDelta.set(randomStream.randomPlusMinusOne() * stepSize,
+                                       randomStream.randomPlusMinusOne() * stepSize,
+                                       randomStream.randomPlusMinusOne() * stepSize);
 
-                        // Calculate new energy
-                        newEnergy = kernel.energy(*i);
-                        newIntraEnergy = kernel.intramolecularEnergy(*mol, *i) * termScale;
+                            // Translate Atom and update its Cell position
+                            i->translateCoordinates(rDelta);
+                            cfg->updateCellLocation(i.get());
 
-                        // Trial the transformed Atom position
-                        delta = (newEnergy + newIntraEnergy) - (currentEnergy + currentIntraEnergy);
-                        accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                            // Calculate new energy
+                            newEnergy = kernel.energy(*i);
+                            newIntraEnergy = kernel.intramolecularEnergy(*mol, *i) * termScale;
 
-                        if (accept)
-                        {
-                            // Accept new (current) position of target Atom
-                            changeStore.updateAtom(n);
-                            currentEnergy = newEnergy;
-                        }
-                        else
-                            changeStore.revert(n);
+                            // Trial the transformed Atom position
+                            delta = (newEnergy + newIntraEnergy) - (currentEnergy + currentIntraEnergy);
+                            accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
 
-                        // Increase attempt counters
-                        // The strategy in force at any one time may vary, so use the distributor's
-                        // helper functions.
-                        if (distributor.collectStatistics())
-                        {
                             if (accept)
                             {
-                                totalDelta += delta;
-                                ++nAccepted;
+                                // Accept new (current) position of target Atom
+                                changeStore.updateAtom(n);
+                                currentEnergy = newEnergy;
                             }
-                            ++nAttempts;
+                            else
+                                changeStore.revert(n);
+
+                            // Increase attempt counters
+                            // The strategy in force at any one time may vary, so use the distributor's
+                            // helper functions.
+                            if (distributor.collectStatistics())
+                            {
+                                if (accept)
+                                {
+                                    totalDelta += delta;
+                                    ++nAccepted;
+                                }
+                                ++nAttempts;
+                            }
+                            ++n;
                         }
-                        ++n;
                     }
-                }
 
-                // Store modifications to Atom positions ready for broadcast later
-                changeStore.storeAndReset();
+                    // Store modifications to Atom positions ready for broadcast later
+                    changeStore.storeAndReset();
 
-                /*
-                 * Calculation End
-                 */
+                    /*
+                     * Calculation End
+                     */
+                }
+
+                // Now all target Molecules have been processes, broadcast the changes made
+                changeStore.distributeAndApply();
+                changeStore.reset();
             }
 
-            // Now all target Molecules have been processes, broadcast the changes made
-            changeStore.distributeAndApply(cfg);
-            changeStore.reset();
+            // Collect statistics across all processe
+            if (!procPool.allSum(&nAccepted, 1, strategy))
+                return false;
+            if (!procPool.allSum(&nAttempts, 1, strategy))
+                return false;
+            if (!procPool.allSum(&totalDelta, 1, strategy))
+                return false;
         }
 
-        // Collect statistics across all processe
-        if (!procPool.allSum(&nAccepted, 1, strategy))
-            return false;
-        if (!procPool.allSum(&nAttempts, 1, strategy))
-            return false;
-        if (!procPool.allSum(&totalDelta, 1, strategy))
-            return false;
-
         timer.stop();
 
         Messenger::print("Total energy delta was {:10.4e} kJ/mol.\n", totalDelta);
@@ -194,7 +319,7 @@ bool AtomShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         // Increase contents version in Configuration
         if (nAccepted > 0)
-            cfg->incrementContentsVersion();
+            cfg->incrementContentsVersionLogged();
     }
 
     return true;
@@ -5,6 +5,8 @@
 
 #include "classes/braggreflection.h"
 #include "classes/partialset.h"
+#include "data/sg/spacegroup.h"
+#include "math/matrix3.h"
 #include "module/module.h"
 
 // Forward Declarations
@@ -54,10 +56,23 @@ class BraggModule : public Module
     /*
      * Members / Functions
      */
+    private:
+    // Spacegroup used to reduce k-vectors to symmetry-unique sets (if set)
+    Spacegroup spacegroup_;
+    // Atom positions at which the current atomic cos/sin terms were calculated
+    std::vector<Vec3<double>> termPositions_;
+    // Configuration Atom index version at which the current atomic cos/sin terms were calculated
+    int termAtomIndexVersion_{-1};
+    // Reciprocal axes used in the calculation of the current atomic cos/sin terms
+    Matrix3 termReciprocalAxes_;
+    // Number of consecutive incremental updates made to the k-vector terms
+    int nIncrementalUpdates_{0};
+
     public:
     // Calculate Bragg terms for specified Configuration
     bool calculateBraggTerms(GenericList &moduleData, ProcessPool &procPool, Configuration *cfg, const double qMin,
-                             const double qDelta, const double qMax, Vec3<int> multiplicity, bool &alreadyUpToDate);
+                             const double qDelta, const double qMax, Vec3<int> multiplicity, bool &alreadyUpToDate,
+                             int incrementalRebuildFrequency = 0);
     // Form partial and total reflection functions from calculated reflection data
     bool formReflectionFunctions(GenericList &moduleData, ProcessPool &procPool, Configuration *cfg, const double qMin,
                                  const double qDelta, const double qMax);
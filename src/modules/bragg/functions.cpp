@@ -11,6 +11,8 @@
 #include "modules/bragg/bragg.h"
 #include "templates/algorithms.h"
 #include "templates/array3d.h"
+#include <numeric>
+#include <tuple>
 
 /*
  * Private Functions
@@ -18,7 +20,8 @@
 
 // Calculate unweighted Bragg scattering for specified Configuration
 bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &procPool, Configuration *cfg, const double qMin,
-                                      const double qDelta, const double qMax, Vec3<int> multiplicity, bool &alreadyUpToDate)
+                                      const double qDelta, const double qMax, Vec3<int> multiplicity, bool &alreadyUpToDate,
+                                      int incrementalRebuildFrequency)
 {
     // Check to see if the arrays are up-to-date
     auto braggDataVersion = moduleData.valueOr<int>("Version", uniqueName_, -1);
@@ -61,9 +64,7 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
     Messenger::print("	r(z) = {:e} {:e} {:e} ({:e})\n", rAxes.columnAsVec3(2).x, rAxes.columnAsVec3(2).y,
                      rAxes.columnAsVec3(2).z, rLengths.z);
 
-    int n, m, h, k, l, kAbs, lAbs;
-    double *cosTermsH, *sinTermsH, *cosTermsK, *sinTermsK, *cosTermsL, *sinTermsL;
-    double hkCos, hkSin, hklCos, hklSin;
+    int h, k, l;
 
     // Create a timer
     Timer timer;
@@ -72,11 +73,20 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
     double mag, magSq;
     int braggIndex;
     timer.start();
-    if (braggKVectors.empty())
+    auto kVectorsCreated = braggKVectors.empty();
+    if (kVectorsCreated)
     {
         Messenger::print("Performing initial set up of Bragg arrays...\n");
         timer.start();
 
+        // The enumerated hkl are indices of the unit cell given by the Box and multiplicity, so the spacegroup operators
+        // are only valid if that is its conventional cell
+        if (spacegroup_.isSet() &&
+            !spacegroup_.isCompatible(rAxes.columnAsVec3(0), rAxes.columnAsVec3(1), rAxes.columnAsVec3(2)))
+            return Messenger::error("Spacegroup {} is not compatible with the unit cell given by the box and multiplicity "
+                                    "({} {} {}) - the unit cell must be the conventional cell of the spacegroup.\n",
+                                    spacegroup_.name(), multiplicity.x, multiplicity.y, multiplicity.z);
+
         double qMaxSq = qMax * qMax, qMinSQ = qMin * qMin;
         auto nBraggBins = qMax / qDelta + 1;
 
@@ -102,6 +112,19 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
             reflxn.initialise(q, -1, nTypes);
             q += qDelta;
         }
+
+        // If a spacegroup is defined, only the representative of each set of symmetry-equivalent k-vectors is retained. Return
+        // the multiplicity of the specified k-vector if it is the representative (the lexicographically largest member of the
+        // set within the enumerated hkl range), or zero otherwise
+        auto symmetryMultiplicity = [&](const Vec3<int> &hkl) {
+            auto equivalents = spacegroup_.equivalentReflections(hkl);
+            for (const auto &eq : equivalents)
+                if (eq.x >= 0 && eq.x <= braggMaximumHKL.x && abs(eq.y) <= braggMaximumHKL.y &&
+                    abs(eq.z) <= braggMaximumHKL.z && std::tie(eq.x, eq.y, eq.z) > std::tie(hkl.x, hkl.y, hkl.z))
+                    return 0;
+            return int(equivalents.size());
+        };
+
         Vec3<double> kVec, v;
         for (h = 0; h <= braggMaximumHKL.x; ++h)
         {
@@ -121,6 +144,11 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
                     magSq = v.magnitudeSq();
                     if ((magSq >= qMinSQ) && (magSq <= qMaxSq))
                     {
+                        // Skip symmetry-equivalent k-vectors which are represented by another
+                        auto kMultiplicity = spacegroup_.isSet() ? symmetryMultiplicity({h, k, l}) : (h == 0 ? 1 : 2);
+                        if (kMultiplicity == 0)
+                            continue;
+
                         mag = sqrt(magSq);
 
                         // Calculate index of associated Bragg reflection in the reflections array
@@ -128,6 +156,7 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
 
                         // Point this (h,k,l) value to this Bragg reflection
                         tempKVectors[{h, k, l}].initialise(h, k, l, braggIndex, nTypes);
+                        tempKVectors[{h, k, l}].setMultiplicity(kMultiplicity);
 
                         // Note in the reflection that we have found another (h,k,l) that contributes to it
                         braggReflections[braggIndex].addKVectors(1);
@@ -161,6 +190,8 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
                          timer.elapsedTimeString());
         Messenger::print("{} unique Bragg reflections found using a Q resolution of {} Angstroms**-1.\n",
                          braggReflections.size(), qDelta);
+        if (spacegroup_.isSet())
+            Messenger::print("K-vectors were reduced to symmetry-unique sets using spacegroup {}.\n", spacegroup_.name());
 
         // Create atom working arrays
         braggAtomVectorXCos.initialise(nAtoms, braggMaximumHKL.x + 1);
@@ -171,27 +202,59 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
         braggAtomVectorZSin.initialise(nAtoms, 2 * braggMaximumHKL.z + 1);
     }
 
-    // Precalculate cos/sin terms for atoms
-    timer.stop();
-    timer.zero();
-    timer.start();
-    Vec3<double> v, rI;
-    for (n = 0; n < nAtoms; ++n)
+    /*
+     * Can we update the existing k-vector terms incrementally? This requires that the k-vectors and reciprocal axes are
+     * unchanged, that the mapping of atoms to array indices is unchanged (stored terms and positions are held by index, so
+     * after a reorder they would be subtracted at the wrong atom types), and that only a small fraction of atoms have moved
+     * since the atomic cos/sin terms were last calculated.
+     * Since the k-vector terms are linear in the atomic contributions, the stored terms for moved atoms are subtracted
+     * before being recalculated and added back in.
+     */
+    std::vector<int> movedAtoms;
+    auto incremental = incrementalRebuildFrequency > 0 && !kVectorsCreated &&
+                       nIncrementalUpdates_ < incrementalRebuildFrequency && termPositions_.size() == nAtoms &&
+                       termAtomIndexVersion_ == cfg->atomIndexVersion();
+    for (auto i = 0; i < 9 && incremental; ++i)
+        if (rAxes[i] != termReciprocalAxes_[i])
+            incremental = false;
+    if (incremental)
     {
+        for (auto n = 0; n < nAtoms; ++n)
+        {
+            const auto &r = atoms[n]->r();
+            if (r.x != termPositions_[n].x || r.y != termPositions_[n].y || r.z != termPositions_[n].z)
+                movedAtoms.push_back(n);
+        }
+        incremental = movedAtoms.size() * 4 < nAtoms;
+    }
+    if (incremental)
+    {
+        Messenger::print("Updating k-vector terms incrementally for {} moved atoms.\n", movedAtoms.size());
+        ++nIncrementalUpdates_;
+    }
+    else
+    {
+        movedAtoms.resize(nAtoms);
+        std::iota(movedAtoms.begin(), movedAtoms.end(), 0);
+        termPositions_.resize(nAtoms);
+        nIncrementalUpdates_ = 0;
+    }
+
+    // Calculate cos/sin terms for specified atom
+    auto calculateAtomTerms = [&](const auto n) {
         // Calculate reciprocal lattice atom coordinates
         // TODO CHECK Test this in a non-cubic system!
-        v = atoms[n]->r();
-        rI.x = v.x * rAxes[0] + v.y * rAxes[1] + v.z * rAxes[2];
-        rI.y = v.x * rAxes[3] + v.y * rAxes[4] + v.z * rAxes[5];
-        rI.z = v.x * rAxes[6] + v.y * rAxes[7] + v.z * rAxes[8];
+        auto v = atoms[n]->r();
+        Vec3<double> rI(v.x * rAxes[0] + v.y * rAxes[1] + v.z * rAxes[2], v.x * rAxes[3] + v.y * rAxes[4] + v.z * rAxes[5],
+                        v.x * rAxes[6] + v.y * rAxes[7] + v.z * rAxes[8]);
 
         // Grab pointers to cos/sin arrays for atom
-        cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
-        cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
-        cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
-        sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
-        sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
-        sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
+        auto *cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
+        auto *cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
+        auto *cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
+        auto *sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
+        auto *sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
+        auto *sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
 
         // Initialise zeroth and first terms
         cosTermsH[0] = 1.0;
@@ -211,68 +274,126 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, ProcessPool &proc
         sinTermsL[-1] = -sinTermsL[1];
 
         // Generate H terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.x; ++m)
+        for (auto m = 2; m <= braggMaximumHKL.x; ++m)
         {
             cosTermsH[m] = cosTermsH[1] * cosTermsH[m - 1] - sinTermsH[1] * sinTermsH[m - 1];
             sinTermsH[m] = cosTermsH[1] * sinTermsH[m - 1] + sinTermsH[1] * cosTermsH[m - 1];
             sinTermsH[-m] = -sinTermsH[m];
         }
         // Generate K terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.y; ++m)
+        for (auto m = 2; m <= braggMaximumHKL.y; ++m)
         {
             cosTermsK[m] = cosTermsK[1] * cosTermsK[m - 1] - sinTermsK[1] * sinTermsK[m - 1];
             sinTermsK[m] = cosTermsK[1] * sinTermsK[m - 1] + sinTermsK[1] * cosTermsK[m - 1];
             sinTermsK[-m] = -sinTermsK[m];
         }
         // Generate L terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.z; ++m)
+        for (auto m = 2; m <= braggMaximumHKL.z; ++m)
         {
             cosTermsL[m] = cosTermsL[1] * cosTermsL[m - 1] - sinTermsL[1] * sinTermsL[m - 1];
             sinTermsL[m] = cosTermsL[1] * sinTermsL[m - 1] + sinTermsL[1] * cosTermsL[m - 1];
             sinTermsL[-m] = -sinTermsL[m];
         }
+    };
+
+    /*
+     * Calculate k-vector contributions, tiling the (atom, k-vector) space. Blocks of k-vectors are divided over processes,
+     * and within each block of atoms the k-vector blocks are divided over threads. Each k-vector block is only ever
+     * accumulated by one thread, and in atom order, so the result is independent of the division of work.
+     */
+    constexpr auto atomBlockSize = 512, kVectorBlockSize = 256;
+    const int nKVectors = braggKVectors.size();
+
+    // Set up structure-of-arrays k-vector indices and atom types
+    std::vector<int> hIndices(nKVectors), kIndices(nKVectors), lIndices(nKVectors), kAbsIndices(nKVectors),
+        lAbsIndices(nKVectors);
+    for (auto i = 0; i < nKVectors; ++i)
+    {
+        hIndices[i] = braggKVectors[i].h();
+        kIndices[i] = braggKVectors[i].k();
+        lIndices[i] = braggKVectors[i].l();
+        kAbsIndices[i] = abs(kIndices[i]);
+        lAbsIndices[i] = abs(lIndices[i]);
     }
-    timer.stop();
-    Messenger::print("Calculated atomic cos/sin terms ({} elapsed)\n", timer.totalTimeString());
-
-    // Calculate k-vector contributions
-    int localTypeIndex;
-
-    // Zero k-vector cos/sin contributions
-    std::for_each(braggKVectors.begin(), braggKVectors.end(), [](auto &kvec) { kvec.zeroCosSinTerms(); });
+    std::vector<int> localTypeIndices(nAtoms);
+    std::transform(atoms.begin(), atoms.end(), localTypeIndices.begin(), [](const auto &i) { return i->localTypeIndex(); });
+
+    // Accumulators for k-vector cos/sin terms, indexed as [type][k-vector]
+    std::vector<double> kVectorCos(nTypes * nKVectors, 0.0), kVectorSin(nTypes * nKVectors, 0.0);
+
+    // Determine k-vector blocks for this process
+    std::vector<int> kVectorBlocks;
+    for (auto block = procPool.interleavedLoopStart(ProcessPool::PoolStrategy); block * kVectorBlockSize < nKVectors;
+         block += procPool.interleavedLoopStride(ProcessPool::PoolStrategy))
+        kVectorBlocks.push_back(block * kVectorBlockSize);
+
+    // Accumulate scaled contributions of specified atoms, using their current cos/sin terms
+    auto accumulateContributions = [&](const std::vector<int> &atomIndices, double factor) {
+        const int nAtomIndices = atomIndices.size();
+        for (auto atomBlock = 0; atomBlock < nAtomIndices; atomBlock += atomBlockSize)
+        {
+            const auto atomEnd = std::min(atomBlock + atomBlockSize, nAtomIndices);
+            dissolve::for_each(ParallelPolicies::par, kVectorBlocks.begin(), kVectorBlocks.end(), [&](const auto kBegin) {
+                const auto kEnd = std::min(kBegin + kVectorBlockSize, nKVectors);
+                for (auto index = atomBlock; index < atomEnd; ++index)
+                {
+                    // Grab array pointers and accumulators for this atom
+                    const auto n = atomIndices[index];
+                    const auto *cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
+                    const auto *cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
+                    const auto *cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
+                    const auto *sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
+                    const auto *sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
+                    const auto *sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
+                    auto *cosAccumulator = &kVectorCos[localTypeIndices[n] * nKVectors];
+                    auto *sinAccumulator = &kVectorSin[localTypeIndices[n] * nKVectors];
+
+                    for (auto i = kBegin; i < kEnd; ++i)
+                    {
+                        // Calculate complex product from atomic cos/sin terms
+                        const auto hkCos = cosTermsH[hIndices[i]] * cosTermsK[kAbsIndices[i]] -
+                                           sinTermsH[hIndices[i]] * sinTermsK[kIndices[i]];
+                        const auto hkSin = cosTermsH[hIndices[i]] * sinTermsK[kIndices[i]] +
+                                           sinTermsH[hIndices[i]] * cosTermsK[kAbsIndices[i]];
+                        cosAccumulator[i] += factor * (hkCos * cosTermsL[lAbsIndices[i]] - hkSin * sinTermsL[lIndices[i]]);
+                        sinAccumulator[i] += factor * (hkCos * sinTermsL[lIndices[i]] + hkSin * cosTermsL[lAbsIndices[i]]);
+                    }
+                }
+            });
+        }
+    };
 
-    // Loop over atoms
+    timer.stop();
+    timer.zero();
     timer.start();
-    for (n = 0; n < nAtoms; ++n)
+
+    // Remove old contributions of moved atoms
+    if (incremental)
+        accumulateContributions(movedAtoms, -1.0);
+
+    // Calculate new cos/sin terms for moved atoms, and store the positions at which they were calculated
+    dissolve::for_each(ParallelPolicies::par, movedAtoms.begin(), movedAtoms.end(), calculateAtomTerms);
+    for (auto n : movedAtoms)
+        termPositions_[n] = atoms[n]->r();
+    termReciprocalAxes_ = rAxes;
+    termAtomIndexVersion_ = cfg->atomIndexVersion();
+
+    // Add new contributions of moved atoms
+    accumulateContributions(movedAtoms, 1.0);
+
+    // Gather contributions from all processes, and store them in the k-vectors
+    if (!procPool.allSum(kVectorCos.data(), kVectorCos.size(), ProcessPool::PoolStrategy) ||
+        !procPool.allSum(kVectorSin.data(), kVectorSin.size(), ProcessPool::PoolStrategy))
+        return false;
+    for (auto i = 0; i < nKVectors; ++i)
     {
-        // Grab localTypeIndex and array pointers for this atom
-        localTypeIndex = atoms[n]->localTypeIndex();
-        cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
-        cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
-        cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
-        sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
-        sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
-        sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
-
-        // Loop over k-vectors
-        for (auto &kvec : braggKVectors)
+        auto &kvec = braggKVectors[i];
+        if (!incremental)
+            kvec.zeroCosSinTerms();
+        for (auto t = 0; t < nTypes; ++t)
         {
-            // Grab h, k, and l indices from KVector
-            h = kvec.h();
-            k = kvec.k();
-            l = kvec.l();
-            kAbs = abs(k);
-            lAbs = abs(l);
-
-            // Calculate complex product from atomic cos/sin terms
-            hkCos = cosTermsH[h] * cosTermsK[kAbs] - sinTermsH[h] * sinTermsK[k];
-            hkSin = cosTermsH[h] * sinTermsK[k] + sinTermsH[h] * cosTermsK[kAbs];
-            hklCos = hkCos * cosTermsL[lAbs] - hkSin * sinTermsL[l];
-            hklSin = hkCos * sinTermsL[l] + hkSin * cosTermsL[lAbs];
-
-            // Sum contribution into the k-vector's cos/sin arrays
-            kvec.addCosTerm(localTypeIndex, hklCos);
-            kvec.addSinTerm(localTypeIndex, hklSin);
+            kvec.addCosTerm(t, kVectorCos[t * nKVectors + i]);
+            kvec.addSinTerm(t, kVectorSin[t * nKVectors + i]);
         }
     }
     timer.stop();
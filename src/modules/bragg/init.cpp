@@ -15,10 +15,18 @@ void BraggModule::initialise()
         "Control",
         new EnumOptionsKeyword<Averaging::AveragingScheme>(Averaging::averagingSchemes() = Averaging::LinearAveraging),
         "AveragingScheme", "Weighting scheme to use when averaging reflection data", "<Linear>");
+    keywords_.add("Control", new IntegerKeyword(0, 0), "IncrementalRebuildFrequency",
+                  "Update k-vector terms incrementally from moved atoms where possible, forcing a full recalculation after "
+                  "this many consecutive updates (0 = always recalculate)",
+                  "<0>");
     keywords_.add("Control", new DoubleKeyword(0.001), "QDelta",
                   "Resolution (bin width) in Q space to use when calculating Bragg reflections", "<0.001>");
     keywords_.add("Control", new DoubleKeyword(1.0), "QMax", "Maximum Q value for Bragg calculation", "<1.0>");
     keywords_.add("Control", new DoubleKeyword(0.01), "QMin", "Minimum Q value for Bragg calculation", "<0.01>");
+    keywords_.add("Control", new StringKeyword(), "SpaceGroup",
+                  "Spacegroup of the unit cell, used to calculate only symmetry-unique k-vectors (weighted by their "
+                  "multiplicities) rather than all k-vectors",
+                  "<name>");
     keywords_.add("Control", new Vec3IntegerKeyword(Vec3<int>(1, 1, 1), Vec3<int>(1, 1, 1), Vec3Labels::HKLLabels),
                   "Multiplicity", "Bragg intensity scaling factor accounting for number of repeat units in Configuration",
                   "<1 1 1>");
@@ -3,6 +3,7 @@
 
 #include "classes/box.h"
 #include "classes/configuration.h"
+#include "classes/kvector.h"
 #include "classes/neutronweights.h"
 #include "classes/species.h"
 #include "main/dissolve.h"
@@ -26,18 +27,26 @@ bool BraggModule::process(Dissolve &dissolve, ProcessPool &procPool)
     auto *cfg = targetConfigurations_.front();
 
     const auto averaging = keywords_.asInt("Averaging");
+    const auto incrementalRebuildFrequency = keywords_.asInt("IncrementalRebuildFrequency");
     auto averagingScheme = Averaging::averagingSchemes().enumeration(keywords_.asString("AveragingScheme"));
     const auto qDelta = keywords_.asDouble("QDelta");
     const auto qMax = keywords_.asDouble("QMax");
     const auto qMin = keywords_.asDouble("QMin");
     const auto multiplicity = keywords_.asVec3Int("Multiplicity");
     const auto saveReflections = keywords_.asBool("SaveReflections");
+    const auto spacegroupName = keywords_.asString("SpaceGroup");
     const auto testReflections = keywords_.asString("TestReflections");
 
     // Print argument/parameter summary
     Messenger::print("Bragg: Calculating Bragg S(Q) over {} < Q < {} Angstroms**-1 using bin size of {} Angstroms**-1.\n", qMin,
                      qMax, qDelta);
     Messenger::print("Bragg: Multiplicity is ({} {} {}).\n", multiplicity.x, multiplicity.y, multiplicity.z);
+    if (!spacegroupName.empty())
+        Messenger::print("Bragg: K-vectors will be reduced using the symmetry of spacegroup {}.\n", spacegroupName);
+    if (incrementalRebuildFrequency > 0)
+        Messenger::print("Bragg: K-vector terms will be updated incrementally where possible, with a full recalculation after "
+                         "{} consecutive updates.\n",
+                         incrementalRebuildFrequency);
     if (averaging <= 1)
         Messenger::print("Bragg: No averaging of reflections will be performed.\n");
     else
@@ -65,9 +74,20 @@ bool BraggModule::process(Dissolve &dissolve, ProcessPool &procPool)
     // Finalise combined AtomTypes matrix
     combinedAtomTypes.finalise();
 
+    // Set up spacegroup, forcing regeneration of the k-vectors if it has changed
+    if (spacegroupName != spacegroup_.name())
+    {
+        if (spacegroupName.empty())
+            spacegroup_.clear();
+        else if (!spacegroup_.set(spacegroupName))
+            return false;
+        dissolve.processingModuleData().realise<std::vector<KVector>>("KVectors", cfg->niceName()).clear();
+    }
+
     // Calculate Bragg vectors and intensities for the current Configuration
     bool alreadyUpToDate;
-    if (!calculateBraggTerms(dissolve.processingModuleData(), procPool, cfg, qMin, qDelta, qMax, multiplicity, alreadyUpToDate))
+    if (!calculateBraggTerms(dissolve.processingModuleData(), procPool, cfg, qMin, qDelta, qMax, multiplicity, alreadyUpToDate,
+                             incrementalRebuildFrequency))
         return false;
 
     // If we are already up-to-date, then theres nothing more to do for this Configuration
@@ -32,7 +32,8 @@ bool ChecksModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Messenger::print("Checks: Threshold for distance checks is {} Angstroms\n", distanceThreshold);
         Messenger::print("Checks: Threshold for angle checks is {} degrees\n", angleThreshold);
 
-        auto &atoms = cfg->atoms();
+        // Atom indices are given in Molecule order
+        const auto atoms = cfg->atomsInMoleculeOrder();
 
         double actual, delta;
         bool ok;
@@ -5,6 +5,7 @@
 
 #include "base/enumoptions.h"
 #include "classes/data1dstore.h"
+#include "classes/scatteringmatrix.h"
 #include "math/data1d.h"
 #include "module/groups.h"
 #include "module/module.h"
@@ -82,6 +83,8 @@ class EPSRModule : public Module
     Data1DStore testData_;
     // Target Configuration (determined from target modules)
     Configuration *targetConfiguration_;
+    // Scattering matrix, retained between iterations so that its inverses may be reused
+    ScatteringMatrix scatteringMatrix_;
 
     private:
     // Create / update delta S(Q) information
@@ -219,7 +219,7 @@ bool EPSRModule::process(Dissolve &dissolve, ProcessPool &procPool)
     // Realise storage for generated S(Q), and initialise a scattering matrix
     auto &estimatedSQ =
         dissolve.processingModuleData().realise<Array2D<Data1D>>("EstimatedSQ", uniqueName_, GenericItem::InRestartFileFlag);
-    ScatteringMatrix scatteringMatrix;
+    auto &scatteringMatrix = scatteringMatrix_;
     scatteringMatrix.initialise(dissolve.atomTypes(), estimatedSQ);
 
     // Loop over target data
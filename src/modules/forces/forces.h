@@ -6,11 +6,13 @@
 #include "io/export/forces.h"
 #include "io/import/forces.h"
 #include "module/module.h"
+#include "templates/optionalref.h"
 #include <memory>
 
 // Forward Declarations
 class Molecule;
 class PotentialMap;
+class VerletList;
 
 // Forces Module
 class ForcesModule : public Module
@@ -77,6 +79,9 @@ class ForcesModule : public Module
     // Calculate interatomic forces within the specified Configuration
     static void interAtomicForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
                                   std::vector<Vec3<double>> &f);
+    // Calculate interatomic forces within the specified Configuration using the supplied Verlet list
+    static void interAtomicForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                  const VerletList &verletList, std::vector<Vec3<double>> &f);
     // Calculate interatomic forces within the specified Species
     static void interAtomicForces(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap,
                                   std::vector<Vec3<double>> &f);
@@ -88,10 +93,20 @@ class ForcesModule : public Module
                                      std::vector<Vec3<double>> &f);
     // Calculate total forces within the specified Configuration
     static void totalForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
-                            std::vector<Vec3<double>> &f);
+                            std::vector<Vec3<double>> &f, OptionalReferenceWrapper<VerletList> verletList = std::nullopt);
     // Calculate forces acting on specific Molecules within the specified Configuration (arising from all atoms)
     static void totalForces(ProcessPool &procPool, Configuration *cfg, const std::vector<const Molecule *> &targetMolecules,
-                            const PotentialMap &potentialMap, std::vector<Vec3<double>> &f);
+                            const PotentialMap &potentialMap, std::vector<Vec3<double>> &f,
+                            OptionalReferenceWrapper<VerletList> verletList = std::nullopt);
     // Calculate total forces within the specified Species
     static void totalForces(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap, std::vector<Vec3<double>> &f);
+    // Calculate interatomic forces within the specified Configuration, returning the interatomic energy
+    static double interAtomicEnergyAndForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                             std::vector<Vec3<double>> &f);
+    // Calculate total forces within the specified Configuration, returning the total energy
+    static double totalEnergyAndForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                       std::vector<Vec3<double>> &f);
+    // Calculate total forces within the specified Species, returning the total energy
+    static double totalEnergyAndForces(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap,
+                                       std::vector<Vec3<double>> &f);
 };
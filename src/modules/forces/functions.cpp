@@ -7,18 +7,12 @@
 #include "classes/forcekernel.h"
 #include "classes/potentialmap.h"
 #include "classes/species.h"
+#include "classes/verletlist.h"
+#include "modules/energy/energy.h"
 #include "modules/forces/forces.h"
 #include "templates/algorithms.h"
 #include "templates/combinable.h"
 
-namespace
-{
-dissolve::CombinableContainer<std::vector<Vec3<double>>> createCombinableForces(std::vector<Vec3<double>> &parentForces)
-{
-    return {parentForces, [&]() { return std::vector<Vec3<double>>(parentForces.size()); }};
-}
-} // namespace
-
 // Calculate interatomic forces within the supplied Configuration
 void ForcesModule::interAtomicForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
                                      std::vector<Vec3<double>> &f)
@@ -30,30 +24,41 @@ void ForcesModule::interAtomicForces(ProcessPool &procPool, Configuration *cfg,
      * This is a parallel routine, with processes operating as process groups.
      */
 
-    // Grab the Cell array
-    const auto &cellArray = cfg->cells();
     // Create a ForceKernel
-    const auto kernel = ForceKernel(procPool, cfg->box(), potentialMap);
-    auto combinableForces = createCombinableForces(f);
+    const auto kernel = ForceKernel(procPool, cfg, potentialMap);
+
+    // Visit each unique Cell pair once - pairs are scheduled by colour so threads can write directly into the force vector
+    kernel.forces(cfg->cells(), ProcessPool::PoolStrategy, f);
+}
+
+// Calculate interatomic forces within the specified Configuration using the supplied Verlet list
+void ForcesModule::interAtomicForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                     const VerletList &verletList, std::vector<Vec3<double>> &f)
+{
+    /*
+     * Calculates the interatomic forces in the supplied Configuration arising from contributions from PairPotential
+     * interactions between individual atoms, taking atom pairs from the supplied (up-to-date) Verlet list.
+     *
+     * This is a parallel routine, with processes operating as process groups.
+     */
+
+    assert(verletList.nAtoms() == cfg->nAtoms());
+
+    // Create a ForceKernel
+    const auto kernel = ForceKernel(procPool, cfg, potentialMap);
+    // Each thread accumulates only the blocks of atoms it touches, which are then summed in parallel
+    auto combinableForces = dissolve::CombinableBlockedVector<Vec3<double>>(f);
 
     // Set start/stride for parallel loop
-    ProcessPool::DivisionStrategy strategy = ProcessPool::PoolStrategy;
-    auto start = procPool.interleavedLoopStart(strategy);
-    auto stride = procPool.interleavedLoopStride(strategy);
-    auto [begin, end] = chop_range(0, cellArray.nCells(), stride, start);
-
-    // algorithm parameters
-    auto unaryOp = [&combinableForces, &kernel, &cellArray, strategy](const int id) {
-        auto *cellI = cellArray.cell(id);
-        auto &fLocal = combinableForces.local();
-        // This cell with itself
-        kernel.forces(cellI, cellI, false, true, ProcessPool::subDivisionStrategy(strategy), fLocal);
-        // Interatomic interactions between atoms in this cell and its neighbours
-        kernel.forces(cellI, true, ProcessPool::subDivisionStrategy(strategy), fLocal);
-    };
-    // Execute lambda operator for each cell
+    auto start = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
+    auto stride = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
+    auto [begin, end] = chop_range(0, cfg->nAtoms(), stride, start);
+
+    // Execute lambda operator for each atom
     dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(begin), dissolve::counting_iterator<int>(end),
-                       unaryOp);
+                       [&combinableForces, &kernel, &verletList](const int indexI) {
+                           kernel.forces(verletList, indexI, combinableForces.local());
+                       });
     combinableForces.finalize();
 }
 
@@ -108,39 +113,34 @@ void ForcesModule::intraMolecularForces(ProcessPool &procPool, Configuration *cf
      */
 
     // Create a ForceKernel
-    ForceKernel kernel(procPool, cfg->box(), potentialMap);
-    auto combinableForces = createCombinableForces(f);
+    ForceKernel kernel(procPool, cfg, potentialMap);
 
     // Set start/stride for parallel loop
-    ProcessPool::DivisionStrategy strategy = ProcessPool::PoolStrategy;
     auto start = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
     auto stride = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
     auto [begin, end] = chop_range(cfg->molecules().begin(), cfg->molecules().end(), stride, start);
 
-    // algorithm parameters
-    auto &molecules = cfg->molecules();
-    auto unaryOp = [&combinableForces, &kernel, &molecules, strategy](const auto &mol) {
-        auto &fLocal = combinableForces.local();
+    // Molecules own disjoint sets of atoms, so each may write its forces directly into the parent vector
+    auto unaryOp = [&f, &kernel](const auto &mol) {
         // Loop over bonds
         for (const auto &bond : mol->species()->bonds())
-            kernel.forces(bond, *mol->atom(bond.indexI()), *mol->atom(bond.indexJ()), fLocal);
+            kernel.forces(bond, *mol->atom(bond.indexI()), *mol->atom(bond.indexJ()), f);
 
         // Loop over angles
         for (const auto &angle : mol->species()->angles())
-            kernel.forces(angle, *mol->atom(angle.indexI()), *mol->atom(angle.indexJ()), *mol->atom(angle.indexK()), fLocal);
+            kernel.forces(angle, *mol->atom(angle.indexI()), *mol->atom(angle.indexJ()), *mol->atom(angle.indexK()), f);
 
         // Loop over torsions
         for (const auto &torsion : mol->species()->torsions())
             kernel.forces(torsion, *mol->atom(torsion.indexI()), *mol->atom(torsion.indexJ()), *mol->atom(torsion.indexK()),
-                          *mol->atom(torsion.indexL()), fLocal);
+                          *mol->atom(torsion.indexL()), f);
 
         // Loop over impropers
         for (const auto &imp : mol->species()->impropers())
             kernel.forces(imp, *mol->atom(imp.indexI()), *mol->atom(imp.indexJ()), *mol->atom(imp.indexK()),
-                          *mol->atom(imp.indexL()), fLocal);
+                          *mol->atom(imp.indexL()), f);
     };
     dissolve::for_each(ParallelPolicies::par, begin, end, unaryOp);
-    combinableForces.finalize();
 }
 
 // Calculate total intramolecular forces in Species
@@ -169,11 +169,12 @@ void ForcesModule::intraMolecularForces(ProcessPool &procPool, Species *sp, cons
 
 // Calculate total forces within the supplied Configuration
 void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
-                               std::vector<Vec3<double>> &f)
+                               std::vector<Vec3<double>> &f, OptionalReferenceWrapper<VerletList> verletList)
 {
     /*
      * Calculates the total forces within the supplied Configuration, arising from PairPotential interactions
-     * and intramolecular contributions.
+     * and intramolecular contributions. If a Verlet list is supplied it is regenerated as necessary and used for the
+     * interatomic forces in place of the Cell structure.
      *
      * This is a serial routine (subroutines called from within are parallel).
      */
@@ -186,7 +187,13 @@ void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const
 
     // Calculate interatomic forces
     timer.start();
-    interAtomicForces(procPool, cfg, potentialMap, f);
+    if (verletList)
+    {
+        verletList->get().update(cfg, potentialMap.range());
+        interAtomicForces(procPool, cfg, potentialMap, verletList->get(), f);
+    }
+    else
+        interAtomicForces(procPool, cfg, potentialMap, f);
     timer.stop();
     Messenger::printVerbose("Time to do interatomic forces was {}.\n", timer.totalTimeString());
 
@@ -203,7 +210,8 @@ void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const
 
 // Calculate forces acting on specific Molecules within the specified Configuration (arising from all atoms)
 void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const std::vector<const Molecule *> &targetMolecules,
-                               const PotentialMap &potentialMap, std::vector<Vec3<double>> &f)
+                               const PotentialMap &potentialMap, std::vector<Vec3<double>> &f,
+                               OptionalReferenceWrapper<VerletList> verletList)
 {
     /*
      * Calculates the total forces acting on the supplied Molecules, arising from PairPotential interactions
@@ -218,7 +226,7 @@ void ForcesModule::totalForces(ProcessPool &procPool, Configuration *cfg, const
     // Create a temporary
     std::vector<Vec3<double>> tempf(f.size(), Vec3<double>());
     std::fill(f.begin(), f.end(), Vec3<double>());
-    totalForces(procPool, cfg, potentialMap, tempf);
+    totalForces(procPool, cfg, potentialMap, tempf, verletList);
 
     // Convert the Molecule array into an array of atoms
     // TODO Calculating forces for whole molecule at once may be more efficient
@@ -237,3 +245,59 @@ void ForcesModule::totalForces(ProcessPool &procPool, Species *sp, const Potenti
 
     intraMolecularForces(procPool, sp, potentialMap, f);
 }
+
+// Calculate interatomic forces within the specified Configuration, returning the interatomic energy
+double ForcesModule::interAtomicEnergyAndForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                                std::vector<Vec3<double>> &f)
+{
+    /*
+     * Calculates the interatomic forces and energy in the supplied Configuration in a single pass over unique Cell
+     * neighbour pairs, so that each atom pair is visited (and its potential looked up) only once. Pairs are scheduled by
+     * colour so that no private force copies are required. The returned energy is process-local.
+     *
+     * This is a parallel routine, with processes operating as process groups.
+     */
+
+    // Create a ForceKernel
+    const auto kernel = ForceKernel(procPool, cfg, potentialMap);
+
+    return kernel.energyAndForces(cfg->cells(), ProcessPool::PoolStrategy, f);
+}
+
+// Calculate total forces within the specified Configuration, returning the total energy
+double ForcesModule::totalEnergyAndForces(ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+                                          std::vector<Vec3<double>> &f)
+{
+    /*
+     * Calculates the total forces and energy within the supplied Configuration, arising from PairPotential interactions
+     * and intramolecular contributions. Equivalent to calling EnergyModule::totalEnergy() followed by totalForces(), but
+     * with only one traversal of the atom pairs.
+     *
+     * This is a serial routine (subroutines called from within are parallel).
+     */
+
+    // Zero force arrays
+    std::fill(f.begin(), f.end(), Vec3<double>());
+
+    // Calculate interatomic energy and forces
+    auto interEnergy = interAtomicEnergyAndForces(procPool, cfg, potentialMap, f);
+
+    // Calculate intramolecular forces
+    intraMolecularForces(procPool, cfg, potentialMap, f);
+
+    // Gather energy and forces together over all processes
+    procPool.allSum(&interEnergy, 1, ProcessPool::PoolStrategy);
+    procPool.allSum(f);
+
+    return interEnergy + EnergyModule::intraMolecularEnergy(procPool, cfg, potentialMap);
+}
+
+// Calculate total forces within the specified Species, returning the total energy
+double ForcesModule::totalEnergyAndForces(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap,
+                                          std::vector<Vec3<double>> &f)
+{
+    std::fill(f.begin(), f.end(), Vec3<double>());
+    totalForces(procPool, sp, potentialMap, f);
+
+    return EnergyModule::totalEnergy(procPool, sp, potentialMap);
+}
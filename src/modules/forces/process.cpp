@@ -9,6 +9,7 @@
 #include "main/dissolve.h"
 #include "modules/forces/forces.h"
 #include "modules/import_trajectory/importtraj.h"
+#include "templates/algorithms.h"
 
 // Run set-up stage
 bool ForcesModule::setUp(Dissolve &dissolve, ProcessPool &procPool)
@@ -411,11 +412,17 @@ bool ForcesModule::process(Dissolve &dissolve, ProcessPool &procPool)
             if (processingData.contains("ReferenceForces", uniqueName()))
             {
                 // Grab reference force array and check size
-                const auto &fRef = processingData.value<std::vector<Vec3<double>>>("ReferenceForces", uniqueName());
-                if (fRef.size() != cfg->nAtoms())
+                const auto &fRefData = processingData.value<std::vector<Vec3<double>>>("ReferenceForces", uniqueName());
+                if (fRefData.size() != cfg->nAtoms())
                     return Messenger::error("Number of force components in ReferenceForces is {}, but the "
                                             "Configuration '{}' contains {} atoms.\n",
-                                            fRef.size(), cfg->name(), cfg->nAtoms());
+                                            fRefData.size(), cfg->name(), cfg->nAtoms());
+
+                // Reference forces are given in Molecule order, so map them onto the Atom array
+                std::vector<Vec3<double>> fRef(cfg->nAtoms());
+                const auto orderedAtoms = cfg->atomsInMoleculeOrder();
+                for (auto &&[i, fi] : zip(orderedAtoms, fRefData))
+                    fRef[i->arrayIndex()] = fi;
 
                 Messenger::print("\nTesting reference forces against calculated 'correct' forces - "
                                  "atoms with erroneous forces will be output...\n");
@@ -521,9 +528,16 @@ bool ForcesModule::process(Dissolve &dissolve, ProcessPool &procPool)
             // Convert forces to 10J/mol
             std::transform(f.begin(), f.end(), f.begin(), [](auto val) { return val * 100.0; });
 
-            // If writing to a file, append it here
-            if (saveData && !exportedForces_.exportData(f))
-                return Messenger::error("Failed to save forces.\n");
+            // If writing to a file, append it here (in Molecule order)
+            if (saveData)
+            {
+                std::vector<Vec3<double>> fOrdered;
+                fOrdered.reserve(f.size());
+                for (const auto *i : cfg->atomsInMoleculeOrder())
+                    fOrdered.push_back(f[i->arrayIndex()]);
+                if (!exportedForces_.exportData(fOrdered))
+                    return Messenger::error("Failed to save forces.\n");
+            }
         }
     }
 
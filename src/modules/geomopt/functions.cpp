@@ -26,6 +26,7 @@ template <> void GeometryOptimisationModule::revertToReferenceCoordinates(Config
 {
     for (auto &&[ref, i] : zip(rRef_, cfg->atoms()))
         i->setCoordinates(ref);
+    cfg->updateCellContents();
 }
 
 // Revert Species to reference coordinates
@@ -60,14 +61,27 @@ void GeometryOptimisationModule::sortBoundsAndEnergies(std::array<double, 3> &bo
     }
 }
 
+// Adjust coordinates of Configuration, following the force vectors from the reference coordinates by the supplied amount
+template <> void GeometryOptimisationModule::setGradientPoint(Configuration *cfg, double delta)
+{
+    for (auto &&[i, r, f] : zip(cfg->atoms(), rRef_, f_))
+        i->setCoordinates(r.x + f.x * delta, r.y + f.y * delta, r.z + f.z * delta);
+    cfg->updateCellContents();
+}
+
+// Adjust coordinates of Species, following the force vectors from the reference coordinates by the supplied amount
+template <> void GeometryOptimisationModule::setGradientPoint(Species *sp, double delta)
+{
+    for (auto &&[i, r, f] : zip(sp->atoms(), rRef_, f_))
+        sp->setAtomCoordinates(&i, Vec3<double>(r.x + f.x * delta, r.y + f.y * delta, r.z + f.z * delta));
+}
+
 // Return energy of adjusted coordinates, following the force vectors by the supplied amount
 template <>
 double GeometryOptimisationModule::energyAtGradientPoint(ProcessPool &procPool, Configuration *cfg,
                                                          const PotentialMap &potentialMap, double delta)
 {
-    for (auto &&[i, r, f] : zip(cfg->atoms(), rRef_, f_))
-        i->setCoordinates(r.x + f.x * delta, r.y + f.y * delta, r.z + f.z * delta);
-    cfg->updateCellContents();
+    setGradientPoint(cfg, delta);
 
     return EnergyModule::totalEnergy(procPool, cfg, potentialMap);
 }
@@ -77,8 +91,7 @@ template <>
 double GeometryOptimisationModule::energyAtGradientPoint(ProcessPool &procPool, Species *sp, const PotentialMap &potentialMap,
                                                          double delta)
 {
-    for (auto &&[i, r, f] : zip(sp->atoms(), rRef_, f_))
-        sp->setAtomCoordinates(&i, Vec3<double>(r.x + f.x * delta, r.y + f.y * delta, r.z + f.z * delta));
+    setGradientPoint(sp, delta);
 
     return EnergyModule::totalEnergy(procPool, sp, potentialMap);
 }
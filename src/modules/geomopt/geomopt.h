@@ -77,6 +77,8 @@ class GeometryOptimisationModule : public Module
     double rmsForce() const;
     // Sort bounds / energies so that minimum energy is in the central position
     void sortBoundsAndEnergies(std::array<double, 3> &bounds, std::array<double, 3> &energies);
+    // Adjust coordinates of target, following the force vectors from the reference coordinates by the supplied amount
+    template <class T> void setGradientPoint(T *target, double delta);
     // Return energy of adjusted coordinates, following the force vectors by the supplied amount
     template <class T>
     double energyAtGradientPoint(ProcessPool &procPool, T *target, const PotentialMap &potentialMap, double delta);
@@ -132,16 +134,16 @@ class GeometryOptimisationModule : public Module
 
         return energies[1];
     }
-    // Line minimise supplied target from the reference coordinates along the stored force vectors
+    // Line minimise supplied target from the reference coordinates (with known energy) along the stored force vectors
     template <class T>
     double lineMinimise(ProcessPool &procPool, T *target, const PotentialMap &potentialMap, const double tolerance,
-                        double &stepSize)
+                        double referenceEnergy, double &stepSize)
     {
         // Brent-style line minimiser with parabolic interpolation and Golden Search backup
 
         // Set initial bounding values
         std::array<double, 3> bounds{0.0, stepSize, 2.0 * stepSize};
-        std::array<double, 3> energies{EnergyModule::totalEnergy(procPool, target, potentialMap),
+        std::array<double, 3> energies{referenceEnergy,
                                        energyAtGradientPoint(procPool, target, potentialMap, bounds[1]),
                                        energyAtGradientPoint(procPool, target, potentialMap, bounds[2])};
 
@@ -220,7 +222,8 @@ class GeometryOptimisationModule : public Module
         // Set an updated step size based on the current bounds
         stepSize = bounds[0] + bounds[1] + bounds[2];
 
-        energyAtGradientPoint(procPool, target, potentialMap, bounds[1]);
+        // Move to the minimum point - its energy is already known
+        setGradientPoint(target, bounds[1]);
 
         return energies[1];
     }
@@ -230,8 +233,7 @@ class GeometryOptimisationModule : public Module
         const auto nStepSizeResetsAllowed = 0;
 
         // Get the initial energy and forces of the Configuration
-        auto oldEnergy = EnergyModule::totalEnergy(procPool, target, dissolve.potentialMap());
-        ForcesModule::totalForces(procPool, target, dissolve.potentialMap(), f_);
+        auto oldEnergy = ForcesModule::totalEnergyAndForces(procPool, target, dissolve.potentialMap(), f_);
         auto oldRMSForce = rmsForce();
 
         // Set initial step size - the line minimiser will modify this as we proceed
@@ -249,11 +251,10 @@ class GeometryOptimisationModule : public Module
             setReferenceCoordinates(target);
 
             // Line minimise along the force gradient
-            auto newEnergy = lineMinimise(procPool, target, dissolve.potentialMap(), tolerance_ * 0.01, stepSize);
+            lineMinimise(procPool, target, dissolve.potentialMap(), tolerance_ * 0.01, oldEnergy, stepSize);
 
-            // Get new forces and RMS for the adjusted coordinates (now stored in the Configuration) and determine
-            // new step size
-            ForcesModule::totalForces(procPool, target, dissolve.potentialMap(), f_);
+            // Get new energy, forces and RMS for the adjusted coordinates (now stored in the Configuration)
+            auto newEnergy = ForcesModule::totalEnergyAndForces(procPool, target, dissolve.potentialMap(), f_);
             auto newRMSForce = rmsForce();
 
             // Calculate deltas
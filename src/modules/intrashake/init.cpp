@@ -9,6 +9,9 @@ void IntraShakeModule::initialise()
 {
     // Control
     keywords_.add("Control", new DoubleKeyword(-1.0), "CutoffDistance", "Interatomic cutoff distance to employ", "<distance>");
+    keywords_.add("Control", new BoolKeyword(false), "LocalEnergy",
+                  "Calculate interatomic energy changes only for atoms displaced by each move, using stored energies for the "
+                  "remaining atoms in the molecule");
     keywords_.add("Control", new IntegerKeyword(1), "ShakesPerTerm", "Number of shakes per term", "<n>");
     keywords_.add("Control", new DoubleKeyword(0.33), "TargetAcceptanceRate", "Target acceptance rate for Monte Carlo moves",
                   "<rate (0.0-1.0)>");
@@ -12,6 +12,7 @@
 #include "classes/speciestorsion.h"
 #include "main/dissolve.h"
 #include "modules/intrashake/intrashake.h"
+#include <numeric>
 
 // Run main processing
 bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -48,6 +49,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto nShakesPerTerm = keywords_.asInt("ShakesPerTerm");
         const auto targetAcceptanceRate = keywords_.asDouble("TargetAcceptanceRate");
         const bool termEnergyOnly = keywords_.asBool("TermEnergyOnly");
+        const auto localEnergy = keywords_.asBool("LocalEnergy");
         auto &torsionStepSize = keywords_.retrieve<double>("TorsionStepSize");
         const auto torsionStepSizeMax = keywords_.asDouble("TorsionStepSizeMax");
         const auto torsionStepSizeMin = keywords_.asDouble("TorsionStepSizeMin");
@@ -72,6 +74,8 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         if (termEnergyOnly)
             Messenger::print("IntraShake: Only term energy will be considered (interatomic contributions with the "
                              "system will be excluded).\n");
+        else if (localEnergy)
+            Messenger::print("IntraShake: Interatomic energy changes will be calculated only for displaced atoms.\n");
         Messenger::print("\n");
 
         ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
@@ -80,11 +84,12 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         RegionalDistributor distributor(cfg->nMolecules(), cfg->cells(), procPool, strategy);
 
         // Create a local ChangeStore and EnergyKernel
-        ChangeStore changeStore(procPool);
+        ChangeStore changeStore(procPool, cfg);
         EnergyKernel kernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
 
-        // Initialise the random number buffer
-        procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+        // Begin a new set of random streams, and get one suitable for our parallel strategy
+        procPool.nextRandomStreamSet();
+        auto randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
 
         // Ensure that the Species used in the present Configuration have attached atom lists
         for (auto &spPop : cfg->speciesPopulations())
@@ -104,6 +109,34 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto *box = cfg->box();
         std::shared_ptr<Atom> i, j, k, l;
 
+        // Interatomic energies of each Atom in the current Molecule, and trial energies of moved Atoms (LocalEnergy only)
+        std::vector<double> atomEnergies, trialAtomEnergies;
+
+        // Calculate interatomic energies of the specified moved Atoms, returning the change from their stored energies
+        auto trialAtomEnergyDelta = [&](const std::shared_ptr<Molecule> &mol, const std::vector<int> &movedAtoms) {
+            auto delta = 0.0;
+            trialAtomEnergies.resize(movedAtoms.size());
+            for (auto n = 0; n < movedAtoms.size(); ++n)
+            {
+                trialAtomEnergies[n] = kernel.energy(*mol->atom(movedAtoms[n]));
+                delta += trialAtomEnergies[n] - atomEnergies[movedAtoms[n]];
+            }
+            return delta;
+        };
+        // Store trial energies of the specified moved Atoms
+        auto acceptTrialAtomEnergies = [&](const std::vector<int> &movedAtoms) {
+            for (auto n = 0; n < movedAtoms.size(); ++n)
+                atomEnergies[movedAtoms[n]] = trialAtomEnergies[n];
+        };
+        // Calculate new interatomic energy of the specified Molecule following a move of the specified Atoms
+        auto newInteratomicEnergy = [&](const std::shared_ptr<Molecule> &mol, const std::vector<int> &movedAtoms) {
+            if (termEnergyOnly)
+                return 0.0;
+            if (localEnergy)
+                return ppEnergy + trialAtomEnergyDelta(mol, movedAtoms);
+            return kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+        };
+
         Timer timer;
         procPool.resetAccumulatedTime();
         while (distributor.cycle())
@@ -117,8 +150,9 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                 // Set the new strategy
                 strategy = distributor.currentStrategy();
 
-                // Re-initialise the random buffer
-                procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+                // Get a new random stream
+                procPool.nextRandomStreamSet();
+                randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
             }
 
             // Loop over target Molecule
@@ -130,13 +164,22 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
                 // Get Molecule index and pointer
                 std::shared_ptr<Molecule> mol = cfg->molecule(molId);
-                const auto indexOffset = mol->atom(0)->arrayIndex();
 
                 // Set current atom targets in ChangeStore (whole molecule)
                 changeStore.add(mol);
 
-                // Calculate reference pairpotential energy for Molecule
-                ppEnergy = termEnergyOnly ? 0.0 : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+                // Calculate reference pairpotential energy for Molecule, storing individual Atom contributions if required
+                if (termEnergyOnly)
+                    ppEnergy = 0.0;
+                else if (localEnergy)
+                {
+                    atomEnergies.resize(mol->nAtoms());
+                    for (auto n = 0; n < mol->nAtoms(); ++n)
+                        atomEnergies[n] = kernel.energy(*mol->atom(n));
+                    ppEnergy = std::accumulate(atomEnergies.begin(), atomEnergies.end(), 0.0);
+                }
+                else
+                    ppEnergy = kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
 
                 // Loop over defined bonds
                 if (adjustBonds)
@@ -151,7 +194,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                         intraEnergy = bond.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(bond, *i, *j);
 
                         // Select random terminus
-                        terminus = procPool.random() > 0.5 ? 1 : 0;
+                        terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                         // Loop over number of shakes per term
                         for (shake = 0; shake < nShakesPerTerm; ++shake)
@@ -159,27 +202,28 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             // Get translation vector, normalise, and apply random delta
                             vji = box->minimumVector(i->r(), j->r());
                             vji.normalise();
-                            vji *= procPool.randomPlusMinusOne() * bondStepSize;
+                            vji *= randomStream.randomPlusMinusOne() * bondStepSize;
 
                             // Adjust the Atoms attached to the selected terminus
                             mol->translate(vji, bond.attachedAtoms(terminus));
 
                             // Update Cell positions of the adjusted Atoms
-                            cfg->updateCellLocation(bond.attachedAtoms(terminus), indexOffset);
+                            cfg->updateCellLocation(bond.attachedAtoms(terminus), mol);
 
                             // Calculate new energy
-                            newPPEnergy =
-                                termEnergyOnly ? 0.0 : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+                            newPPEnergy = newInteratomicEnergy(mol, bond.attachedAtoms(terminus));
                             newIntraEnergy = bond.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(bond, *i, *j);
 
                             // Trial the transformed Molecule
                             delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                            accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                            accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
 
                             // Accept new (current) positions of the Molecule's Atoms?
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                if (localEnergy)
+                                    acceptTrialAtomEnergies(bond.attachedAtoms(terminus));
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -205,7 +249,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                         intraEnergy = angle.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(angle, *i, *j, *k);
 
                         // Select random terminus
-                        terminus = procPool.random() > 0.5 ? 1 : 0;
+                        terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                         // Loop over number of shakes per term
                         for (shake = 0; shake < nShakesPerTerm; ++shake)
@@ -216,28 +260,30 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             v = vji * vjk;
 
                             // Create suitable transformation matrix
-                            transform.createRotationAxis(v.x, v.y, v.z, procPool.randomPlusMinusOne() * angleStepSize, true);
+                            transform.createRotationAxis(v.x, v.y, v.z, randomStream.randomPlusMinusOne() * angleStepSize,
+                                                         true);
 
                             // Adjust the Atoms attached to the selected terminus
                             mol->transform(box, transform, angle.j()->r(), angle.attachedAtoms(terminus));
 
                             // Update Cell positions of the adjusted Atoms
-                            cfg->updateCellLocation(angle.attachedAtoms(terminus), indexOffset);
+                            cfg->updateCellLocation(angle.attachedAtoms(terminus), mol);
 
                             // Calculate new energy
-                            newPPEnergy =
-                                termEnergyOnly ? 0.0 : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+                            newPPEnergy = newInteratomicEnergy(mol, angle.attachedAtoms(terminus));
                             newIntraEnergy =
                                 angle.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(angle, *i, *j, *k);
 
                             // Trial the transformed Molecule
                             delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                            accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                            accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
 
                             // Accept new (current) positions of the Molecule's Atoms?
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                if (localEnergy)
+                                    acceptTrialAtomEnergies(angle.attachedAtoms(terminus));
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -265,7 +311,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             torsion.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(torsion, *i, *j, *k, *l);
 
                         // Select random terminus
-                        terminus = procPool.random() > 0.5 ? 1 : 0;
+                        terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                         // Loop over number of shakes per term
                         for (shake = 0; shake < nShakesPerTerm; ++shake)
@@ -274,29 +320,30 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                             vjk = box->minimumVector(j->r(), k->r());
 
                             // Create suitable transformation matrix
-                            transform.createRotationAxis(vjk.x, vjk.y, vjk.z, procPool.randomPlusMinusOne() * torsionStepSize,
-                                                         true);
+                            transform.createRotationAxis(vjk.x, vjk.y, vjk.z,
+                                                         randomStream.randomPlusMinusOne() * torsionStepSize, true);
 
                             // Adjust the Atoms attached to the selected terminus
                             mol->transform(box, transform, terminus == 0 ? j->r() : k->r(), torsion.attachedAtoms(terminus));
 
                             // Update Cell positions of the adjusted Atoms
-                            cfg->updateCellLocation(torsion.attachedAtoms(terminus), indexOffset);
+                            cfg->updateCellLocation(torsion.attachedAtoms(terminus), mol);
 
                             // Calculate new energy
-                            newPPEnergy =
-                                termEnergyOnly ? 0.0 : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+                            newPPEnergy = newInteratomicEnergy(mol, torsion.attachedAtoms(terminus));
                             newIntraEnergy =
                                 torsion.inCycle() ? kernel.intramolecularEnergy(*mol) : kernel.energy(torsion, *i, *j, *k, *l);
 
                             // Trial the transformed Molecule
                             delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                            accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                            accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
 
                             // Accept new (current) positions of the Molecule's Atoms?
                             if (accept)
                             {
                                 changeStore.updateAll();
+                                if (localEnergy)
+                                    acceptTrialAtomEnergies(torsion.attachedAtoms(terminus));
                                 ppEnergy = newPPEnergy;
                                 intraEnergy = newIntraEnergy;
                                 distributor.increase(totalDelta, delta);
@@ -318,7 +365,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
             }
 
             // Now all target Molecules have been processes, broadcast the changes made
-            changeStore.distributeAndApply(cfg);
+            changeStore.distributeAndApply();
             changeStore.reset();
         }
         timer.stop();
@@ -396,7 +443,7 @@ bool IntraShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         // Increase contents version in Configuration
         if ((nBondAccepted > 0) || (nAngleAccepted > 0) || (nTorsionAccepted > 0))
-            cfg->incrementContentsVersion();
+            cfg->incrementContentsVersionLogged();
     }
 
     return true;
@@ -21,6 +21,8 @@ void MDModule::initialise()
                   "Whether random velocities should always be assigned before beginning MD simulation");
     keywords_.add("Control", new SpeciesVectorKeyword(), "RestrictToSpecies",
                   "Restrict the calculation to the specified Species");
+    keywords_.add("Control", new DoubleKeyword(0.0, 0.0), "VerletSkin",
+                  "Skin distance (Angstroms) for Verlet neighbour lists used in force calculation (or 0 to use cells)");
 
     // Output
     keywords_.add("Output", new IntegerKeyword(10), "EnergyFrequency",
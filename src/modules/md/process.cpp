@@ -7,6 +7,7 @@
 #include "classes/cell.h"
 #include "classes/forcekernel.h"
 #include "classes/species.h"
+#include "classes/verletlist.h"
 #include "data/atomicmasses.h"
 #include "main/dissolve.h"
 #include "modules/energy/energy.h"
@@ -41,6 +42,7 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
     const auto onlyWhenEnergyStable = keywords_.asBool("OnlyWhenEnergyStable");
     const auto trajectoryFrequency = keywords_.asInt("TrajectoryFrequency");
     const auto variableTimestep = keywords_.asBool("VariableTimestep");
+    const auto verletSkin = keywords_.asDouble("VerletSkin");
     const auto restrictToSpecies = keywords_.retrieve<std::vector<const Species *>>("RestrictToSpecies");
     auto writeTraj = trajectoryFrequency > 0;
 
@@ -67,6 +69,8 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Messenger::print("MD: Variable timestep will be employed.");
     else
         Messenger::print("MD: Constant timestep of {:e} ps will be used.\n", deltaT);
+    if (verletSkin > 0.0)
+        Messenger::print("MD: Verlet neighbour lists with a skin of {} Angstroms will be used for forces.\n", verletSkin);
     if (!restrictToSpecies.empty())
     {
         std::string speciesNames;
@@ -100,6 +104,12 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
         std::vector<double> mass(cfg->nAtoms(), 0.0);
         std::vector<Vec3<double>> forces(cfg->nAtoms()), accelerations(cfg->nAtoms());
 
+        // Create Verlet neighbour list if requested
+        VerletList verletList(verletSkin);
+        OptionalReferenceWrapper<VerletList> optVerletList;
+        if (verletSkin > 0.0)
+            optVerletList = verletList;
+
         // Variables
         auto nCapped = 0;
         auto &atoms = cfg->atoms();
@@ -125,14 +135,18 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
          */
 
         // Read in or assign random velocities
-        // Realise the velocity array from the moduleData
-        auto [velocities, status] = dissolve.processingModuleData().realiseIf<std::vector<Vec3<double>>>(
+        // Realise the velocity array from the moduleData - this is stored in Molecule order, so map it onto the Atom array
+        auto [storedVelocities, status] = dissolve.processingModuleData().realiseIf<std::vector<Vec3<double>>>(
             fmt::format("{}//Velocities", cfg->niceName()), uniqueName(), GenericItem::InRestartFileFlag);
         if (status == GenericItem::ItemStatus::Created)
         {
             randomVelocities = true;
-            velocities.resize(cfg->nAtoms(), Vec3<double>());
+            storedVelocities.resize(cfg->nAtoms(), Vec3<double>());
         }
+        const auto orderedAtoms = cfg->atomsInMoleculeOrder();
+        std::vector<Vec3<double>> velocities(cfg->nAtoms());
+        for (auto &&[i, v] : zip(orderedAtoms, storedVelocities))
+            velocities[i->arrayIndex()] = v;
         if (randomVelocities)
             Messenger::print("Random initial velocities will be assigned.\n");
         else
@@ -224,9 +238,9 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
         if (variableTimestep)
         {
             if (targetMolecules.empty())
-                ForcesModule::totalForces(procPool, cfg, dissolve.potentialMap(), forces);
+                ForcesModule::totalForces(procPool, cfg, dissolve.potentialMap(), forces, optVerletList);
             else
-                ForcesModule::totalForces(procPool, cfg, targetMolecules, dissolve.potentialMap(), forces);
+                ForcesModule::totalForces(procPool, cfg, targetMolecules, dissolve.potentialMap(), forces, optVerletList);
 
             // Must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
             std::transform(forces.begin(), forces.end(), forces.begin(), [](auto f) { return f * 100.0; });
@@ -258,9 +272,9 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
             // Calculate forces - must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
             if (targetMolecules.empty())
-                ForcesModule::totalForces(procPool, cfg, dissolve.potentialMap(), forces);
+                ForcesModule::totalForces(procPool, cfg, dissolve.potentialMap(), forces, optVerletList);
             else
-                ForcesModule::totalForces(procPool, cfg, targetMolecules, dissolve.potentialMap(), forces);
+                ForcesModule::totalForces(procPool, cfg, targetMolecules, dissolve.potentialMap(), forces, optVerletList);
             std::transform(forces.begin(), forces.end(), forces.begin(), [](auto &f) { return f * 100.0; });
 
             // Cap forces
@@ -328,7 +342,7 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
                     }
 
                     // Write Atoms
-                    for (const auto &i : atoms)
+                    for (const auto *i : orderedAtoms)
                     {
                         if (!trajParser.writeLineF("{:<3}   {:10.3f}  {:10.3f}  {:10.3f}\n",
                                                    Elements::symbol(i->speciesAtom()->Z()), i->r().x, i->r().y, i->r().z))
@@ -355,6 +369,13 @@ bool MDModule::process(Dissolve &dissolve, ProcessPool &procPool)
                              double(nCapped) / nSteps);
         Messenger::print("{} steps performed ({} work, {} comms)\n", nSteps, timer.totalTimeString(),
                          procPool.accumulatedTimeString());
+        if (verletSkin > 0.0)
+            Messenger::print("Verlet neighbour list was generated {} times ({} pairs at last generation).\n",
+                             verletList.nGenerations(), verletList.nPairs());
+
+        // Store velocities in Molecule order
+        for (auto &&[i, v] : zip(orderedAtoms, storedVelocities))
+            v = velocities[i->arrayIndex()];
 
         // Increment configuration changeCount
         cfg->incrementContentsVersion();
@@ -8,8 +8,14 @@
 void MolShakeModule::initialise()
 {
     // Control
+    keywords_.add("Control", new BoolKeyword(false), "Checkerboard",
+                  "Perform moves over threads using a checkerboard decomposition of the cells, rather than distributing "
+                  "molecules over processes");
     keywords_.add("Control", new DoubleKeyword(-1.0), "CutoffDistance",
                   "Interatomic cutoff distance to use for energy calculation");
+    keywords_.add("Control", new BoolKeyword(false), "EnergyCache",
+                  "Take reference energies of molecules from a cache held by the configuration and updated as moves are "
+                  "accepted, rather than recalculating them (single process only)");
     keywords_.add("Control", new IntegerKeyword(1), "ShakesPerMolecule", "Number of shakes to attempt per molecule", "<n>");
     keywords_.add("Control", new DoubleKeyword(0.33), "TargetAcceptanceRate", "Target acceptance rate for Monte Carlo moves",
                   "<rate (0.0 - 1.0)>");
@@ -6,12 +6,14 @@
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/changestore.h"
+#include "classes/checkerboarddistributor.h"
 #include "classes/configuration.h"
 #include "classes/regionaldistributor.h"
 #include "classes/scaledenergykernel.h"
 #include "classes/species.h"
 #include "main/dissolve.h"
 #include "modules/molshake/molshake.h"
+#include <numeric>
 
 // Run main processing
 bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
@@ -45,6 +47,8 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
         const auto translationStepSizeMax = keywords_.asDouble("TranslationStepSizeMax");
         const auto translationStepSizeMin = keywords_.asDouble("TranslationStepSizeMin");
         const auto restrictToSpecies = keywords_.retrieve<std::vector<const Species *>>("RestrictToSpecies");
+        const auto checkerboard = keywords_.asBool("Checkerboard");
+        const auto useEnergyCache = keywords_.asBool("EnergyCache");
         const auto rRT = 1.0 / (.008314472 * cfg->temperature());
 
         // Print argument/parameter summary
@@ -63,40 +67,31 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
                 speciesNames += fmt::format("  {}", sp->name());
             Messenger::print("MolShake: Calculation will be restricted to species:{}\n", speciesNames);
         }
+        if (checkerboard)
+            Messenger::print("MolShake: Moves will be performed over threads using a checkerboard decomposition.\n");
+        if (useEnergyCache)
+            Messenger::print("MolShake: Reference energies of molecules will be taken from the energy cache.\n");
         Messenger::print("\n");
 
-        ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
-
-        // Create a Molecule distributor
-        RegionalDistributor distributor(cfg->nMolecules(), cfg->cells(), procPool, strategy);
-
-        // Determine target molecules from the restrictedSpecies vector (if any) and give to the distributor
+        // Determine target molecules from the restrictedSpecies vector (if any)
+        std::vector<int> targetMoleculeIndices;
         if (!restrictToSpecies.empty())
         {
-            std::vector<int> targetIndices;
             auto id = 0;
             for (const auto &mol : cfg->molecules())
             {
                 if (std::find(restrictToSpecies.begin(), restrictToSpecies.end(), mol->species()) != restrictToSpecies.end())
-                    targetIndices.push_back(id);
+                    targetMoleculeIndices.push_back(id);
                 ++id;
             }
-            distributor.setTargetMolecules(targetIndices);
         }
 
-        // Create a local ChangeStore and a suitable EnergyKernel
-        ChangeStore changeStore(procPool);
+        // Create a suitable EnergyKernel
         EnergyKernel kernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
 
-        // Initialise the random number buffer
-        procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
-
-        int shake, nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
-                   nGeneralAttempts = 0;
-        bool accept;
-        double currentEnergy, newEnergy, delta, totalDelta = 0.0;
-        Matrix3 transform;
-        Vec3<double> rDelta;
+        auto nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
+             nGeneralAttempts = 0;
+        auto totalDelta = 0.0;
         const auto *box = cfg->box();
 
         /*
@@ -104,154 +99,361 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
          * including both a translation a rotation, 10% using only translations, and 10% using only rotations.
          */
 
-        // Set initial random offset for our counter determining whether to perform R+T, R, or T.
-        auto count = procPool.random() * 10;
-        bool rotate, translate;
+        // Cached Molecule energies, if in use
+        MoleculeEnergyCache *energyCache = nullptr;
 
         Timer timer;
         procPool.resetAccumulatedTime();
-        while (distributor.cycle())
+        if (checkerboard)
         {
-            // Get next set of Molecule targets from the distributor
-            auto &targetIndices = distributor.assignedMolecules();
+            /*
+             * Perform moves with threads over a checkerboard decomposition of the Cells, in which Molecules whose centres
+             * lie in blocks of the same colour cannot interact, and so may be moved concurrently. Every process performs the
+             * same moves from the same random numbers, but since threaded energy sums are not reproducible bit-for-bit the
+             * acceptance of moves may differ, so the master's coordinates are broadcast after the sweep.
+             */
 
-            // Switch parallel strategy if necessary
-            if (distributor.currentStrategy() != strategy)
+            if (useEnergyCache)
+                Messenger::warn("The energy cache cannot be used with checkerboard moves, so will be ignored.\n");
+
+            if (targetMoleculeIndices.empty())
             {
-                // Set the new strategy
-                strategy = distributor.currentStrategy();
+                targetMoleculeIndices.resize(cfg->nMolecules());
+                std::iota(targetMoleculeIndices.begin(), targetMoleculeIndices.end(), 0);
+            }
 
-                // Re-initialise the random buffer
-                procPool.initialiseRandomBuffer(ProcessPool::subDivisionStrategy(strategy));
+            // Determine the furthest that any Atom can travel from the Cell containing its Molecule's centre
+            auto maxRadius = 0.0;
+            for (auto molId : targetMoleculeIndices)
+            {
+                auto mol = cfg->molecule(molId);
+                auto centre = mol->centreOfGeometry(box);
+                for (const auto &i : mol->atoms())
+                    maxRadius = std::max(maxRadius, box->minimumDistance(centre, i->r()));
             }
+            const auto maxTravel = nShakesPerMolecule * sqrt(3.0) * translationStepSize;
+
+            // Assign Molecules to blocks according to their centres
+            CheckerboardDistributor checkerboard(cfg->cells(), maxRadius + maxTravel);
+            for (auto molId : targetMoleculeIndices)
+                checkerboard.addTarget(molId, cfg->cells().cell(cfg->molecule(molId)->centreOfGeometry(box)));
+            if (!checkerboard.isConcurrent())
+                Messenger::warn("Box is too small for a checkerboard decomposition - moves will be performed serially.\n");
+
+            // Begin a new set of random streams - each block takes its own stream, identical on all processes
+            procPool.nextRandomStreamSet();
+            const auto nBlocks = checkerboard.nBlocks();
+
+            // Store original Atom positions so that moves can be logged in the Configuration
+            std::vector<Vec3<double>> originalR(cfg->nAtoms());
+            for (const auto &i : cfg->atoms())
+                originalR[i->arrayIndex()] = i->r();
+
+            // Shake Molecules in each block, with blocks of the same colour processed concurrently
+            struct BlockStatistics
+            {
+                int nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
+                    nGeneralAttempts = 0;
+                double totalDelta = 0.0;
+            };
+            std::vector<BlockStatistics> blockStatistics(nBlocks.x * nBlocks.y * nBlocks.z);
+            checkerboard.forEachBlock([&](const auto blockIndex, const auto &blockTargets) {
+                auto randomStream = procPool.randomStream(ProcessPool::PoolStrategy, blockIndex);
+                ChangeStore changeStore(procPool, cfg);
+                // Kernels reuse internal scratch space between calls, so each block needs its own
+                EnergyKernel blockKernel(procPool, cfg, dissolve.potentialMap(), cutoffDistance);
+                auto &stats = blockStatistics[blockIndex];
+                auto count = int(randomStream.random() * 10);
+                Matrix3 transform;
+                Vec3<double> rDelta;
+
+                for (auto molId : blockTargets)
+                {
+                    auto mol = cfg->molecule(molId);
+                    changeStore.add(mol);
+
+                    auto currentEnergy = blockKernel.energy(*mol, ProcessPool::PoolStrategy, false);
+
+                    for (auto shake = 0; shake < nShakesPerMolecule; ++shake)
+                    {
+                        // Determine what move(s) will we attempt
+                        auto rotate = count != 1;
+                        auto translate = count != 0;
+
+                        if (translate)
+                        {
+                            rDelta.set(randomStream.randomPlusMinusOne() * translationStepSize,
+                                       randomStream.randomPlusMinusOne() * translationStepSize,
+                                       randomStream.randomPlusMinusOne() * translationStepSize);
+                            mol->translate(rDelta);
+                        }
+                        if (rotate)
+                        {
+                            transform.createRotationXY(randomStream.randomPlusMinusOne() * rotationStepSize,
+                                                       randomStream.randomPlusMinusOne() * rotationStepSize);
+                            mol->transform(box, transform);
+                        }
+                        cfg->updateCellLocation(mol);
+
+                        // Calculate new energy and trial the move
+                        auto newEnergy = blockKernel.energy(*mol, ProcessPool::PoolStrategy, false);
+                        auto delta = newEnergy - currentEnergy;
+                        auto accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
+                        if (accept)
+                        {
+                            changeStore.updateAll();
+                            currentEnergy = newEnergy;
+                            stats.totalDelta += delta;
+                        }
+                        else
+                            changeStore.revertAll();
+
+                        // Increase attempt counters
+                        if (rotate)
+                        {
+                            if (accept)
+                                ++stats.nRotationsAccepted;
+                            ++stats.nRotationAttempts;
+                        }
+                        if (translate)
+                        {
+                            if (accept)
+                                ++stats.nTranslationsAccepted;
+                            ++stats.nTranslationAttempts;
+                        }
+                        ++stats.nGeneralAttempts;
+
+                        // Increase and fold move type counter
+                        count = (count + 1) % 10;
+                    }
+
+                    changeStore.reset();
+                }
+            });
 
-            // Loop over target Molecules
-            for (auto molId : targetIndices)
+            // Make the master's coordinates definitive on all processes
+            if (procPool.nProcesses() > 1 && !cfg->broadcastCoordinates(procPool))
+                return false;
+
+            // Log moved Atoms in the Configuration
+            for (const auto &i : cfg->atoms())
+                if ((i->r() - originalR[i->arrayIndex()]).magnitudeSq() > 0.0)
+                    cfg->logAtomMove(i->arrayIndex(), originalR[i->arrayIndex()]);
+
+            // Sum statistics over blocks, taking those of the master (whose coordinates were kept) on all processes
+            for (const auto &stats : blockStatistics)
+            {
+                nRotationAttempts += stats.nRotationAttempts;
+                nTranslationAttempts += stats.nTranslationAttempts;
+                nRotationsAccepted += stats.nRotationsAccepted;
+                nTranslationsAccepted += stats.nTranslationsAccepted;
+                nGeneralAttempts += stats.nGeneralAttempts;
+                totalDelta += stats.totalDelta;
+            }
+            if (procPool.nProcesses() > 1)
             {
-                /*
-                 * Calculation Begins
-                 */
+                if (!procPool.broadcast(totalDelta))
+                    return false;
+                if (!procPool.broadcast(nGeneralAttempts))
+                    return false;
+                if (!procPool.broadcast(nTranslationAttempts))
+                    return false;
+                if (!procPool.broadcast(nTranslationsAccepted))
+                    return false;
+                if (!procPool.broadcast(nRotationAttempts))
+                    return false;
+                if (!procPool.broadcast(nRotationsAccepted))
+                    return false;
+            }
+        }
+        else
+        {
+            ProcessPool::DivisionStrategy strategy = procPool.bestStrategy();
 
-                // Get Molecule index and pointer
-                auto mol = cfg->molecule(molId);
+            // Create a Molecule distributor
+            RegionalDistributor distributor(cfg->nMolecules(), cfg->cells(), procPool, strategy);
+            if (!targetMoleculeIndices.empty())
+                distributor.setTargetMolecules(targetMoleculeIndices);
 
-                // Set current atom targets in ChangeStore (whole Molecule)
-                changeStore.add(mol);
+            // Create a local ChangeStore
+            ChangeStore changeStore(procPool, cfg);
 
-                // Calculate reference energy for Molecule, including intramolecular terms
-                currentEnergy = kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+            // Begin a new set of random streams, and get one suitable for our parallel strategy
+            procPool.nextRandomStreamSet();
+            auto randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
 
-                // Loop over number of shakes per atom
-                for (shake = 0; shake < nShakesPerMolecule; ++shake)
+            // Set up the energy cache if requested - every move must be made on this process for it to remain consistent
+            if (useEnergyCache && procPool.nProcesses() > 1)
+                Messenger::warn("The energy cache can only be used on a single process, so will be ignored.\n");
+            else if (useEnergyCache)
+            {
+                energyCache = &cfg->moleculeEnergyCache();
+                if (!energyCache->isValid(cfg, cutoffDistance))
                 {
-                    // Determine what move(s) will we attempt
-                    if (count == 0)
-                    {
-                        rotate = true;
-                        translate = false;
-                    }
-                    else if (count == 1)
-                    {
-                        rotate = false;
-                        translate = true;
-                    }
-                    else
-                    {
-                        rotate = true;
-                        translate = true;
-                    }
+                    Messenger::print("Calculating molecule energies for the energy cache...\n");
+                    energyCache->calculate(cfg, kernel, cutoffDistance);
+                }
+            }
+            std::vector<std::pair<int, double>> trialMoleculeEnergies;
 
-                    // Create a random translation vector and apply it to the Molecule's centre
-                    if (translate)
-                    {
-                        rDelta.set(procPool.randomPlusMinusOne() * translationStepSize,
-                                   procPool.randomPlusMinusOne() * translationStepSize,
-                                   procPool.randomPlusMinusOne() * translationStepSize);
-                        mol->translate(rDelta);
-                    }
+            int shake;
+            bool accept;
+            double currentEnergy, newEnergy, delta;
+            Matrix3 transform;
+            Vec3<double> rDelta;
 
-                    // Create a random rotation matrix and apply it to the Molecule
-                    if (rotate)
-                    {
-                        transform.createRotationXY(procPool.randomPlusMinusOne() * rotationStepSize,
-                                                   procPool.randomPlusMinusOne() * rotationStepSize);
-                        mol->transform(box, transform);
-                    }
+            // Set initial random offset for our counter determining whether to perform R+T, R, or T.
+            auto count = randomStream.random() * 10;
+            bool rotate, translate;
+
+            while (distributor.cycle())
+            {
+                // Get next set of Molecule targets from the distributor
+                auto &targetIndices = distributor.assignedMolecules();
+
+                // Switch parallel strategy if necessary
+                if (distributor.currentStrategy() != strategy)
+                {
+                    // Set the new strategy
+                    strategy = distributor.currentStrategy();
+
+                    // Get a new random stream
+                    procPool.nextRandomStreamSet();
+                    randomStream = procPool.randomStream(ProcessPool::subDivisionStrategy(strategy));
+                }
 
-                    // Update Cell positions of Atoms in the Molecule
-                    cfg->updateCellLocation(mol);
+                // Loop over target Molecules
+                for (auto molId : targetIndices)
+                {
+                    /*
+                     * Calculation Begins
+                     */
 
-                    // Calculate new energy
-                    newEnergy = kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+                    // Get Molecule index and pointer
+                    auto mol = cfg->molecule(molId);
 
-                    // Trial the transformed atom position
-                    delta = newEnergy - currentEnergy;
-                    accept = delta < 0 ? true : (procPool.random() < exp(-delta * rRT));
+                    // Set current atom targets in ChangeStore (whole Molecule)
+                    changeStore.add(mol);
 
-                    if (accept)
-                    {
-                        // Accept new (current) position of target Atoms
-                        changeStore.updateAll();
-                        currentEnergy = newEnergy;
-                    }
-                    else
-                        changeStore.revertAll();
+                    // Calculate reference energy for Molecule, including intramolecular terms
+                    currentEnergy = energyCache ? energyCache->energy(molId)
+                                                : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
 
-                    // Increase attempt counters
-                    // The strategy in force at any one time may vary, so use the distributor's helper
-                    // functions.
-                    if (distributor.collectStatistics())
+                    // Loop over number of shakes per atom
+                    for (shake = 0; shake < nShakesPerMolecule; ++shake)
                     {
-                        if (accept)
-                            totalDelta += delta;
-                        if (rotate)
+                        // Determine what move(s) will we attempt
+                        if (count == 0)
                         {
-                            if (accept)
-                                ++nRotationsAccepted;
-                            ++nRotationAttempts;
+                            rotate = true;
+                            translate = false;
                         }
+                        else if (count == 1)
+                        {
+                            rotate = false;
+                            translate = true;
+                        }
+                        else
+                        {
+                            rotate = true;
+                            translate = true;
+                        }
+
+                        // Create a random translation vector and apply it to the Molecule's centre
                         if (translate)
+                        {
+                            rDelta.set(randomStream.randomPlusMinusOne() * translationStepSize,
+                                       randomStream.randomPlusMinusOne() * translationStepSize,
+                                       randomStream.randomPlusMinusOne() * translationStepSize);
+                            mol->translate(rDelta);
+                        }
+
+                        // Create a random rotation matrix and apply it to the Molecule
+                        if (rotate)
+                        {
+                            transform.createRotationXY(randomStream.randomPlusMinusOne() * rotationStepSize,
+                                                       randomStream.randomPlusMinusOne() * rotationStepSize);
+                            mol->transform(box, transform);
+                        }
+
+                        // Update Cell positions of Atoms in the Molecule
+                        cfg->updateCellLocation(mol);
+
+                        // Calculate new energy
+                        newEnergy = energyCache ? kernel.energy(*mol, trialMoleculeEnergies)
+                                                : kernel.energy(*mol, ProcessPool::subDivisionStrategy(strategy), true);
+
+                        // Trial the transformed atom position
+                        delta = newEnergy - currentEnergy;
+                        accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
+
+                        if (accept)
+                        {
+                            // Accept new (current) position of target Atoms
+                            changeStore.updateAll();
+                            currentEnergy = newEnergy;
+                            if (energyCache)
+                                energyCache->update(molId, trialMoleculeEnergies);
+                        }
+                        else
+                            changeStore.revertAll();
+
+                        // Increase attempt counters
+                        // The strategy in force at any one time may vary, so use the distributor's helper
+                        // functions.
+                        if (distributor.collectStatistics())
                         {
                             if (accept)
-                                ++nTranslationsAccepted;
-                            ++nTranslationAttempts;
+                                totalDelta += delta;
+                            if (rotate)
+                            {
+                                if (accept)
+                                    ++nRotationsAccepted;
+                                ++nRotationAttempts;
+                            }
+                            if (translate)
+                            {
+                                if (accept)
+                                    ++nTranslationsAccepted;
+                                ++nTranslationAttempts;
+                            }
+                            ++nGeneralAttempts;
                         }
-                        ++nGeneralAttempts;
+
+                        // Increase and fold move type counter
+                        ++count;
+                        if (count > 9)
+                            count = 0;
                     }
 
-                    // Increase and fold move type counter
-                    ++count;
-                    if (count > 9)
-                        count = 0;
-                }
+                    // Store modifications to Atom positions ready for broadcast
+                    changeStore.storeAndReset();
 
-                // Store modifications to Atom positions ready for broadcast
-                changeStore.storeAndReset();
+                    /*
+                     * Calculation End
+                     */
+                }
 
-                /*
-                 * Calculation End
-                 */
+                // Now all target Molecules have been processes, broadcast the changes made
+                changeStore.distributeAndApply();
+                changeStore.reset();
             }
 
-            // Now all target Molecules have been processes, broadcast the changes made
-            changeStore.distributeAndApply(cfg);
-            changeStore.reset();
+            // Collect statistics across all processes
+            if (!procPool.allSum(&totalDelta, 1))
+                return false;
+            if (!procPool.allSum(&nGeneralAttempts, 1))
+                return false;
+            if (!procPool.allSum(&nTranslationAttempts, 1))
+                return false;
+            if (!procPool.allSum(&nTranslationsAccepted, 1))
+                return false;
+            if (!procPool.allSum(&nRotationAttempts, 1))
+                return false;
+            if (!procPool.allSum(&nRotationsAccepted, 1))
+                return false;
         }
 
-        // Collect statistics across all processes
-        if (!procPool.allSum(&totalDelta, 1))
-            return false;
-        if (!procPool.allSum(&nGeneralAttempts, 1))
-            return false;
-        if (!procPool.allSum(&nTranslationAttempts, 1))
-            return false;
-        if (!procPool.allSum(&nTranslationsAccepted, 1))
-            return false;
-        if (!procPool.allSum(&nRotationAttempts, 1))
-            return false;
-        if (!procPool.allSum(&nRotationsAccepted, 1))
-            return false;
-
         timer.stop();
 
         Messenger::print("Total energy delta was {:10.4e} kJ/mol.\n", totalDelta);
@@ -286,7 +488,13 @@ bool MolShakeModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         // Increase contents version in Configuration
         if ((nRotationsAccepted > 0) || (nTranslationsAccepted > 0))
-            cfg->incrementContentsVersion();
+        {
+            cfg->incrementContentsVersionLogged();
+
+            // The energy cache has been updated with every accepted move, so remains valid
+            if (energyCache)
+                energyCache->setContentsVersion(cfg->contentsVersion());
+        }
     }
 
     return true;
@@ -6,34 +6,43 @@
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
+#include "classes/molecule.h"
 #include "classes/species.h"
 #include "classes/speciesangle.h"
 #include "classes/speciesbond.h"
 #include "classes/speciestorsion.h"
 #include "main/dissolve.h"
-#include "math/combinations.h"
 #include "math/error.h"
 #include "math/filters.h"
 #include "module/group.h"
 #include "modules/rdf/rdf.h"
 #include "templates/algorithms.h"
 #include "templates/combinable.h"
+#include <algorithm>
 #include <iterator>
+#include <map>
+#include <numeric>
 #include <tuple>
 
 namespace
 {
+// Return offset of the bins for the specified partial within a flat array of histogram bins for all partials
+int flatHistogramOffset(int typeI, int typeJ, int nTypes, int nBins)
+{
+    return (std::min(typeI, typeJ) * nTypes + std::max(typeI, typeJ)) * nBins;
+}
 
-void addHistogramsToPartialSet(Array2D<Histogram1D> &histograms, PartialSet &target)
+// Add flat array of histogram bins for all partials into the histograms returned by the supplied function
+template <class HistogramFunction>
+void addFlatHistograms(const std::vector<long int> &flatBins, int nTypes, HistogramFunction histogram)
 {
-    for (auto k = 0; k < target.nAtomTypes(); ++k)
-        for (auto j = 0; j < target.nAtomTypes(); ++j)
-        {
-            auto &histo = target.fullHistogram(k, j);
-            histo = std::move(histograms[{k, j}]);
-        }
+    for_each_pair(0, nTypes, [&](int typeI, int typeJ) {
+        auto &target = histogram(typeI, typeJ);
+        target.addBinCounts(flatBins.data() + flatHistogramOffset(typeI, typeJ, nTypes, target.nBins()));
+    });
 }
 } // namespace
+
 /*
  * Private Functions
  */
@@ -55,181 +64,336 @@ bool RDFModule::calculateGRTestSerial(Configuration *cfg, PartialSet &partialSet
 // Calculate partial g(r) with optimised double-loop
 bool RDFModule::calculateGRSimple(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth)
 {
-    // Variables
-    int n, m, nTypes, typeI, typeJ, i, j, nPoints;
-
-    // Construct local arrays of atom type positions
-    nTypes = partialSet.nAtomTypes();
+    // Construct local arrays of atom type positions, reusing storage from any previous calculation
+    auto nTypes = partialSet.nAtomTypes();
     Messenger::printVerbose("Constructing local partial working arrays for {} types.\n", nTypes);
     const auto *box = cfg->box();
-    std::vector<Vec3<double> *> r(nTypes);
-    std::vector<int> maxr(nTypes), nr(nTypes);
-    std::vector<int *> binss(nTypes);
-    int *bins;
-
-    n = 0;
+    typeCoordinates_.resize(nTypes);
+    auto n = 0;
     for (auto &atd : cfg->usedAtomTypesList())
     {
-        maxr[n] = atd.population();
-        nr[n] = 0;
-        r[n] = new Vec3<double>[maxr[n]];
-        binss[n] = new int[maxr[n]];
+        typeCoordinates_[n].clear();
+        typeCoordinates_[n].reserve(atd.population());
         ++n;
     }
 
     // Loop over Atoms and construct arrays
-    auto &atoms = cfg->atoms();
-    for (n = 0; n < cfg->nAtoms(); ++n)
-    {
-        m = atoms[n]->localTypeIndex();
-        r[m][nr[m]++] = atoms[n]->r();
-    }
+    for (const auto &i : cfg->atoms())
+        typeCoordinates_[i->localTypeIndex()].push_back(i->r());
 
     Messenger::printVerbose("Ready..\n");
 
-    // Loop over assigned Atoms
-    Vec3<double> centre, *ri, *rj, mim;
-    double rbin = 1.0 / binWidth;
+    const auto rbin = 1.0 / binWidth;
 
     // Loop context is to use all processes in Pool as one group
     auto offset = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
     auto nChunks = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
 
+    // Bin distances between atoms of the specified types, threading over central atoms with per-thread private histograms
+    auto binTypePair = [&](int typeI, int typeJ) {
+        const auto &ri = typeCoordinates_[typeI];
+        const auto &rj = typeCoordinates_[typeJ];
+        auto &histogram = partialSet.fullHistogram(typeI, typeJ).bins();
+        const auto nBins = partialSet.fullHistogram(typeI, typeJ).nBins();
+        auto combinableBins = dissolve::CombinableContainer<std::vector<long int>>(
+            histogram, [&histogram]() { return std::vector<long int>(histogram.size(), 0); });
+
+        auto [begin, end] = chop_range(0, int(ri.size()), nChunks, offset);
+        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(begin),
+                           dissolve::counting_iterator<int>(end), [&](const auto i) {
+                               auto &bins = combinableBins.local();
+                               const auto &centre = ri[i];
+                               for (auto j = (typeI == typeJ ? i + 1 : 0); j < rj.size(); ++j)
+                               {
+                                   auto bin = int(box->minimumDistance(centre, rj[j]) * rbin);
+                                   if (bin < nBins)
+                                       ++bins[bin];
+                               }
+                           });
+        combinableBins.finalize();
+    };
+
     Messenger::printVerbose("Self terms..\n");
 
     // Self terms
-    for (typeI = 0; typeI < nTypes; ++typeI)
-    {
-        ri = r[typeI];
-        auto &histogram = partialSet.fullHistogram(typeI, typeI).bins();
-        bins = binss[typeI];
-        nPoints = partialSet.fullHistogram(typeI, typeI).nBins();
-        for_each_pair(ri, ri + maxr[typeI], nChunks, offset,
-                      [box, bins, rbin, nPoints, &histogram](int i, auto centre, int j, auto other) {
-                          if (i == j)
-                              return;
-                          bins[j] = box->minimumDistance(centre, other) * rbin;
-                          if (bins[j] < nPoints)
-                              ++histogram[bins[j]];
-                      });
-    }
+    for (auto typeI = 0; typeI < nTypes; ++typeI)
+        binTypePair(typeI, typeI);
 
     Messenger::printVerbose("Cross terms..\n");
 
     // Cross terms
-    for (typeI = 0; typeI < nTypes; ++typeI)
+    for (auto typeI = 0; typeI < nTypes; ++typeI)
     {
-        ri = r[typeI];
-        for (typeJ = 0; typeJ < nTypes; ++typeJ)
+        for (auto typeJ = 0; typeJ < nTypes; ++typeJ)
         {
             // Skip if typeI == typeJ, or if the number of atoms in typeI is greater than typeJ (since it is less
             // efficient)
             if (typeI == typeJ)
                 continue;
-            if (nr[typeI] > nr[typeJ])
+            auto nI = typeCoordinates_[typeI].size(), nJ = typeCoordinates_[typeJ].size();
+            if (nI > nJ)
                 continue;
-            if ((nr[typeI] == nr[typeJ]) && (typeI > typeJ))
+            if ((nI == nJ) && (typeI > typeJ))
                 continue;
 
-            rj = r[typeJ];
-            auto &histogram = partialSet.fullHistogram(typeI, typeJ).bins();
-            bins = binss[typeJ];
-            nPoints = partialSet.fullHistogram(typeI, typeJ).nBins();
-            auto [begin, end] = chop_range(0, maxr[typeI], nChunks, offset);
-            for (i = begin; i < end; ++i)
-            {
-                centre = ri[i];
-                for (j = 0; j < maxr[typeJ]; ++j)
-                    bins[j] = box->minimumDistance(centre, rj[j]) * rbin;
-                for (j = 0; j < maxr[typeJ]; ++j)
-                    if (bins[j] < nPoints)
-                        ++histogram[bins[j]];
-            }
+            binTypePair(typeI, typeJ);
         }
     }
 
-    // Delete temporary arrays
-    for (auto n = 0; n < nTypes; ++n)
-    {
-        delete[] r[n];
-        delete[] binss[n];
-    }
-
     return true;
 }
 
-bool RDFModule::calculateGRCells(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange)
+// Update full partial g(r) histograms incrementally from the Configuration's change log
+bool RDFModule::calculateGRIncremental(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth)
 {
-    auto &cellArray = cfg->cells();
+    /*
+     * For every atom moved since the histograms were last calculated, the contributions of all pairs involving that atom are
+     * removed using the original (logged) positions, and then re-added using the current positions. Only atoms in Cells
+     * within the RDF range of the relevant position are considered - unmoved atoms are found from the current Cell contents,
+     * and moved atoms at their original positions from a separate binning of the change log over the same Cells. Pairs in
+     * which both atoms have moved are considered once only, from the atom which appears first in the change log. Increments
+     * for all partials are accumulated into per-thread private histograms and summed over processes before being applied.
+     */
+
+    const auto *box = cfg->box();
+    const auto &cells = cfg->cells();
+    const auto &changeLog = cfg->changeLog();
+    const auto &atoms = cfg->atoms();
+    const auto nAtoms = cfg->nAtoms();
+    const auto nTypes = partialSet.nAtomTypes();
+    const auto nBins = partialSet.fullHistogram(0, 0).nBins();
+    const auto rbin = 1.0 / binWidth;
+    const auto gridDeltas = cells.neighbourGridDeltas(partialSet.rdfRange());
+
+    // Gather current coordinates and type indices, and the position of each atom in the change log
+    std::vector<Vec3<double>> r(nAtoms);
+    std::vector<int> types(nAtoms), logIndex(nAtoms, -1);
+    for (auto n = 0; n < nAtoms; ++n)
+    {
+        r[n] = atoms[n]->r();
+        types[n] = atoms[n]->localTypeIndex();
+    }
+    for (auto n = 0; n < changeLog.size(); ++n)
+        logIndex[changeLog[n].first] = n;
+
+    // Bin change log entries by the Cells containing the original positions of their atoms
+    std::vector<int> originalCells(changeLog.size()), originalCellOffsets(cells.nCells() + 1, 0),
+        originalCellEntries(changeLog.size());
+    for (auto k = 0; k < changeLog.size(); ++k)
+    {
+        originalCells[k] = cells.cell(changeLog[k].second)->index();
+        ++originalCellOffsets[originalCells[k] + 1];
+    }
+    std::partial_sum(originalCellOffsets.begin(), originalCellOffsets.end(), originalCellOffsets.begin());
+    auto nextEntry = originalCellOffsets;
+    for (auto k = 0; k < changeLog.size(); ++k)
+        originalCellEntries[nextEntry[originalCells[k]]++] = k;
+
+    // Determine unique indices of Cells within range of the supplied central Cell
+    auto searchCells = [&](const Cell *centralCell, std::vector<int> &cellIndices) {
+        cellIndices.clear();
+        cellIndices.push_back(centralCell->index());
+        const auto &ref = centralCell->gridReference();
+        for (const auto &delta : gridDeltas)
+            cellIndices.push_back(cells.cell(ref.x + delta.x, ref.y + delta.y, ref.z + delta.z)->index());
+        std::sort(cellIndices.begin(), cellIndices.end());
+        cellIndices.erase(std::unique(cellIndices.begin(), cellIndices.end()), cellIndices.end());
+    };
+
+    std::vector<long int> deltaBins(nTypes * nTypes * nBins, 0);
+    auto combinableBins = dissolve::CombinableContainer<std::vector<long int>>(
+        deltaBins, [&deltaBins]() { return std::vector<long int>(deltaBins.size(), 0); });
 
     // Loop context is to use all processes in Pool as one group
-    Combinations comb(cellArray.nCells(), 2);
     auto offset = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
     auto nChunks = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
-    auto [cStart, cEnd] = chop_range(0, comb.getNumCombinations(), nChunks, offset);
-
-    auto combinableHistograms = dissolve::CombinableValue<Array2D<Histogram1D>>([&partialSet]() {
-        Array2D<Histogram1D> histograms;
-        histograms.initialise(partialSet.nAtomTypes(), partialSet.nAtomTypes(), true);
-        for (auto i = 0; i < partialSet.nAtomTypes(); ++i)
-            for (auto j = i; j < partialSet.nAtomTypes(); ++j)
-                histograms[{i, j}] = partialSet.fullHistogram(i, j);
-        return histograms;
-    });
+    auto [begin, end] = chop_range(0, int(changeLog.size()), nChunks, offset);
+    dissolve::for_each(
+        ParallelPolicies::par, dissolve::counting_iterator<int>(begin), dissolve::counting_iterator<int>(end),
+        [&](const auto k) {
+            auto &bins = combinableBins.local();
+            auto i = changeLog[k].first;
+            const auto &rIOld = changeLog[k].second;
+            std::vector<int> cellIndices;
+
+            // Remove contributions at original positions
+            searchCells(cells.cell(originalCells[k]), cellIndices);
+            for (auto cellIndex : cellIndices)
+            {
+                for (auto j : cells.cell(cellIndex)->atomIndices())
+                {
+                    if (logIndex[j] != -1)
+                        continue;
+                    auto bin = int(box->minimumDistance(rIOld, r[j]) * rbin);
+                    if (bin < nBins)
+                        --bins[flatHistogramOffset(types[i], types[j], nTypes, nBins) + bin];
+                }
+                for (auto m = originalCellOffsets[cellIndex]; m < originalCellOffsets[cellIndex + 1]; ++m)
+                {
+                    auto kJ = originalCellEntries[m];
+                    if (kJ <= k)
+                        continue;
+                    auto j = changeLog[kJ].first;
+                    auto bin = int(box->minimumDistance(rIOld, changeLog[kJ].second) * rbin);
+                    if (bin < nBins)
+                        --bins[flatHistogramOffset(types[i], types[j], nTypes, nBins) + bin];
+                }
+            }
 
-    auto unaryOp = [&combinableHistograms, cfg, &comb, rdfRange](const auto idx) {
-        // auto &histograms = combinableHistograms.local().histograms_;
-        auto &histograms = combinableHistograms.local();
-        const auto *box = cfg->box();
-        auto &cellArray = cfg->cells();
-        auto [n, m] = comb.nthCombination(idx);
-        auto *cellI = cellArray.cell(n);
-        auto *cellJ = cellArray.cell(m);
-
-        if (!cellArray.withinRange(cellI, cellJ, rdfRange))
-            return;
-
-        // Add contributions between atoms in cellI and cellJ
-        auto &atomsI = cellI->atoms();
-        auto &atomsJ = cellJ->atoms();
-
-        // Perform minimum image calculation on all atom pairs -
-        // quicker than working out if we need to given the absence of a 2D look-up array
-        for (auto &i : atomsI)
-        {
-            auto typeI = i->localTypeIndex();
-            auto &rI = i->r();
+            // Add contributions at current positions
+            searchCells(cells.cell(r[i]), cellIndices);
+            for (auto cellIndex : cellIndices)
+                for (auto j : cells.cell(cellIndex)->atomIndices())
+                {
+                    // Skip self, and pairs already considered from the other atom
+                    if (j == i || (logIndex[j] != -1 && logIndex[j] < k))
+                        continue;
+                    auto bin = int(box->minimumDistance(r[i], r[j]) * rbin);
+                    if (bin < nBins)
+                        ++bins[flatHistogramOffset(types[i], types[j], nTypes, nBins) + bin];
+                }
+        });
+    combinableBins.finalize();
+
+#ifdef PARALLEL
+    if (!procPool.allSum(deltaBins.data(), deltaBins.size()))
+        return false;
+#endif
+
+    // Apply increments to the full histograms
+    addFlatHistograms(deltaBins, nTypes,
+                      [&partialSet](int typeI, int typeJ) -> Histogram1D & { return partialSet.fullHistogram(typeI, typeJ); });
+
+    return true;
+}
+
+// Calculate bound partial g(r) histograms, considering Molecules with the specified start/stride
+void RDFModule::calculateBoundGR(Configuration *cfg, PartialSet &partialSet, int offset, int nChunks)
+{
+    /*
+     * Molecules are grouped by Species so that the atom pairs and their partial histogram offsets are determined only once
+     * per Species, and then all Molecules of that Species are binned in parallel. Molecules are distributed over processes
+     * with the supplied stride through the main Molecule array.
+     * NOTE: If you attempt to use chop_range to distribute Molecules, instead of stride, it will fail.
+     * The problem does not seem to be in chop_range, but rather in how the loops are merged.
+     * This is GitHub issue #562
+     */
+
+    const auto *box = cfg->box();
+    const auto &molecules = cfg->molecules();
+    const auto nTypes = partialSet.nAtomTypes();
+    const auto nBins = partialSet.boundHistogram(0, 0).nBins();
+    const auto rbin = 1.0 / partialSet.boundHistogram(0, 0).binWidth();
+
+    // Group our Molecules by Species
+    std::map<const Species *, std::vector<const Molecule *>> speciesMolecules;
+    for (auto n = offset; n < molecules.size(); n += nChunks)
+        speciesMolecules[molecules[n]->species()].push_back(molecules[n].get());
+
+    std::vector<long int> allBins(nTypes * nTypes * nBins, 0);
+    auto combinableBins = dissolve::CombinableContainer<std::vector<long int>>(
+        allBins, [&allBins]() { return std::vector<long int>(allBins.size(), 0); });
+
+    // Intramolecular atom pair indices and the offsets of their partial histograms
+    std::vector<std::tuple<int, int, int>> atomPairs;
+    for (auto &[sp, spMolecules] : speciesMolecules)
+    {
+        // Construct atom pair table from the first Molecule - types are the same in all Molecules of this Species
+        atomPairs.clear();
+        const auto &firstAtoms = spMolecules.front()->atoms();
+        for (auto i = 0; i < firstAtoms.size(); ++i)
+            for (auto j = i + 1; j < firstAtoms.size(); ++j)
+                atomPairs.emplace_back(
+                    i, j,
+                    flatHistogramOffset(firstAtoms[i]->localTypeIndex(), firstAtoms[j]->localTypeIndex(), nTypes, nBins));
+
+        dissolve::for_each(ParallelPolicies::par, spMolecules.begin(), spMolecules.end(), [&](const auto *mol) {
+            auto &bins = combinableBins.local();
+            const auto &atoms = mol->atoms();
+            for (auto &[i, j, typeOffset] : atomPairs)
+            {
+                auto bin = int(box->minimumDistance(atoms[i]->r(), atoms[j]->r()) * rbin);
+                if (bin < nBins)
+                    ++bins[typeOffset + bin];
+            }
+        });
+    }
+    combinableBins.finalize();
 
-            for (auto &j : atomsJ)
+    addFlatHistograms(allBins, nTypes,
+                      [&partialSet](int typeI, int typeJ) -> Histogram1D & { return partialSet.boundHistogram(typeI, typeJ); });
+}
+
+bool RDFModule::calculateGRCells(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange)
+{
+    const auto *box = cfg->box();
+    const auto &atomArrays = cfg->atomArrays();
+    const auto *types = atomArrays.localTypeIndices();
+    const auto nTypes = partialSet.nAtomTypes();
+    const auto nBins = partialSet.fullHistogram(0, 0).nBins();
+    const auto rbin = 1.0 / partialSet.fullHistogram(0, 0).binWidth();
+
+    // Get all pairs of cells which may contain atoms within the RDF range
+    auto cellPairs = cfg->cells().neighbourPairs(rdfRange);
+
+    // Threads accumulate into private copies of the histogram bins only, stored as a flat array over all partials
+    std::vector<long int> allBins(nTypes * nTypes * nBins, 0);
+    auto combinableBins = dissolve::CombinableContainer<std::vector<long int>>(
+        allBins, [&allBins]() { return std::vector<long int>(allBins.size(), 0); });
+
+    auto unaryOp = [&](const auto &cellPair) {
+        auto &bins = combinableBins.local();
+        auto [cellI, cellJ] = cellPair;
+        auto &indicesI = cellI->atomIndices();
+        auto &indicesJ = cellJ->atomIndices();
+
+        if (cellI == cellJ)
+        {
+            // Add contributions between atoms in cellI - no need to perform MIM since we're in the same cell
+            for (auto n = 0; n < indicesI.size(); ++n)
             {
-                auto &rJ = j->r();
-                auto distance = box->minimumDistance(rJ, rI);
-                histograms[{typeI, j->localTypeIndex()}].bin(distance);
+                auto indexI = indicesI[n];
+                auto rI = atomArrays.r(indexI);
+                for (auto m = n + 1; m < indicesI.size(); ++m)
+                {
+                    auto bin = int((atomArrays.r(indicesI[m]) - rI).magnitude() * rbin);
+                    if (bin < nBins)
+                        ++bins[flatHistogramOffset(types[indexI], types[indicesI[m]], nTypes, nBins) + bin];
+                }
+            }
+        }
+        else
+        {
+            // Add contributions between atoms in cellI and cellJ, performing minimum image calculation on all atom pairs -
+            // quicker than working out if we need to given the absence of a 2D look-up array
+            for (auto indexI : indicesI)
+            {
+                auto typeI = types[indexI];
+                auto rI = atomArrays.r(indexI);
+
+                for (auto indexJ : indicesJ)
+                {
+                    auto bin = int(box->minimumDistance(atomArrays.r(indexJ), rI) * rbin);
+                    if (bin < nBins)
+                        ++bins[flatHistogramOffset(typeI, types[indexJ], nTypes, nBins) + bin];
+                }
             }
         }
     };
 
-    // Execute lambda operator for each cell
-    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(cStart), dissolve::counting_iterator<int>(cEnd),
-                       unaryOp);
-    auto histograms = combinableHistograms.finalize();
-    addHistogramsToPartialSet(histograms, partialSet);
+    // Loop context is to use all processes in Pool as one group
+    auto offset = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
+    auto nChunks = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
+    auto [begin, end] = chop_range(cellPairs.begin(), cellPairs.end(), nChunks, offset);
+
+    // Execute lambda operator for each cell pair
+    dissolve::for_each(ParallelPolicies::par, begin, end, unaryOp);
+    combinableBins.finalize();
+
+    // Add binned data into the partial histograms
+    addFlatHistograms(allBins, nTypes,
+                      [&partialSet](int typeI, int typeJ) -> Histogram1D & { return partialSet.fullHistogram(typeI, typeJ); });
 
-    auto [start, end] = chop_range(0, cellArray.nCells(), nChunks, offset);
-    for (int n = start; n < end; ++n)
-    {
-        auto *cellI = cellArray.cell(n);
-        auto &atomsI = cellI->atoms();
-
-        // Add contributions between atoms in cellI
-        for_each_pair(atomsI.begin(), atomsI.end(), [&](const int idx, auto &i, const int jdx, auto &j) {
-            if (idx == jdx)
-                return;
-            // No need to perform MIM since we're in the same cell
-            double distance = (i->r() - j->r()).magnitude();
-            partialSet.fullHistogram(i->localTypeIndex(), j->localTypeIndex()).bin(distance);
-        });
-    }
     return true;
 }
 
@@ -283,7 +447,7 @@ std::vector<std::pair<const Species *, double>> RDFModule::speciesPopulations()
 // Calculate unweighted partials for the specified Configuration
 bool RDFModule::calculateGR(GenericList &processingData, ProcessPool &procPool, Configuration *cfg,
                             RDFModule::PartialsMethod method, const double rdfRange, const double rdfBinWidth,
-                            bool &alreadyUpToDate)
+                            bool &alreadyUpToDate, int incrementalRebuildFrequency)
 {
     // Does a PartialSet already exist for this Configuration?
     auto originalGRObject = processingData.realiseIf<PartialSet>(fmt::format("{}//OriginalGR", cfg->niceName()), uniqueName_,
@@ -303,32 +467,78 @@ bool RDFModule::calculateGR(GenericList &processingData, ProcessPool &procPool,
         return true;
     }
 
-    Messenger::print("Calculating partial g(r) for Configuration '{}'...\n", cfg->name());
-
     /*
-     * Make sure histograms are set up, and reset any existing data
+     * Can we update the existing histograms incrementally? All changes since they were calculated must have been logged,
+     * their range and bin width must be unchanged, a full rebuild must not be due, and the estimated number of pair distances
+     * required by the update must be smaller than that required by a full recalculation with the method in use.
      */
 
-    originalgr.setUpHistograms(rdfRange, rdfBinWidth);
-    originalgr.reset();
+    auto incrementalIsCheaper = [&]() {
+        const auto &cells = cfg->cells();
+        if (cells.nCells() == 0)
+            return false;
+        const auto nAtoms = double(cfg->nAtoms());
+        const auto atomsPerCell = nAtoms / cells.nCells();
+        const auto nSearchCells = double(std::min(int(cells.neighbourGridDeltas(rdfRange).size()) + 1, cells.nCells()));
+        const auto nIncrementalPairs = 2.0 * cfg->changeLog().size() * nSearchCells * atomsPerCell;
+        const auto useCells =
+            method == RDFModule::CellsMethod || (method == RDFModule::AutoMethod && cfg->nAtoms() > 10000);
+        const auto nFullPairs = useCells ? 0.5 * nAtoms * nSearchCells * atomsPerCell : 0.5 * nAtoms * nAtoms;
+        return nIncrementalPairs < nFullPairs;
+    };
 
-    /*
-     * Calculate full (intra+inter) partials
-     */
+    auto &nIncrementalUpdates = nIncrementalUpdates_[cfg];
+    auto incremental = (method != RDFModule::TestMethod) && (incrementalRebuildFrequency > 0) &&
+                       (nIncrementalUpdates < incrementalRebuildFrequency) && cfg->changeLogValid() &&
+                       DissolveSys::sameString(originalgr.fingerprint(), fmt::format("{}", cfg->changeLogStartVersion())) &&
+                       (fabs(originalgr.rdfRange() - rdfRange) < 1.0e-8) &&
+                       (fabs(originalgr.rdfBinWidth() - rdfBinWidth) < 1.0e-8) && incrementalIsCheaper();
 
     Timer timer;
     timer.start();
     procPool.resetAccumulatedTime();
-    if (method == RDFModule::TestMethod)
-        calculateGRTestSerial(cfg, originalgr);
-    else if (method == RDFModule::SimpleMethod)
-        calculateGRSimple(procPool, cfg, originalgr, rdfBinWidth);
-    else if (method == RDFModule::CellsMethod)
-        calculateGRCells(procPool, cfg, originalgr, rdfRange);
-    else if (method == RDFModule::AutoMethod)
+    if (incremental)
     {
-        cfg->nAtoms() > 10000 ? calculateGRCells(procPool, cfg, originalgr, rdfRange)
-                              : calculateGRSimple(procPool, cfg, originalgr, rdfBinWidth);
+        Messenger::print("Updating partial g(r) for Configuration '{}' from {} moved atoms...\n", cfg->name(),
+                         cfg->changeLog().size());
+
+        /*
+         * Update full (intra+inter) partials, and reset bound histograms ready for recalculation
+         */
+
+        if (!calculateGRIncremental(procPool, cfg, originalgr, rdfBinWidth))
+            return false;
+        for_each_pair(0, originalgr.nAtomTypes(),
+                      [&originalgr](int typeI, int typeJ) { originalgr.boundHistogram(typeI, typeJ).zeroBins(); });
+        ++nIncrementalUpdates;
+    }
+    else
+    {
+        Messenger::print("Calculating partial g(r) for Configuration '{}'...\n", cfg->name());
+
+        /*
+         * Make sure histograms are set up, and reset any existing data
+         */
+
+        originalgr.setUpHistograms(rdfRange, rdfBinWidth);
+        originalgr.reset();
+        nIncrementalUpdates = 0;
+
+        /*
+         * Calculate full (intra+inter) partials
+         */
+
+        if (method == RDFModule::TestMethod)
+            calculateGRTestSerial(cfg, originalgr);
+        else if (method == RDFModule::SimpleMethod)
+            calculateGRSimple(procPool, cfg, originalgr, rdfBinWidth);
+        else if (method == RDFModule::CellsMethod)
+            calculateGRCells(procPool, cfg, originalgr, rdfRange);
+        else if (method == RDFModule::AutoMethod)
+        {
+            cfg->nAtoms() > 10000 ? calculateGRCells(procPool, cfg, originalgr, rdfRange)
+                                  : calculateGRSimple(procPool, cfg, originalgr, rdfBinWidth);
+        }
     }
     timer.stop();
     Messenger::print("Finished calculation of partials ({} elapsed, {} comms).\n", timer.totalTimeString(),
@@ -345,29 +555,7 @@ bool RDFModule::calculateGR(GenericList &processingData, ProcessPool &procPool,
     auto nChunks = (method == RDFModule::TestMethod ? 1 : procPool.interleavedLoopStride(ProcessPool::PoolStrategy));
 
     timer.start();
-
-    // Loop over molecules...
-    // NOTE: If you attempt to use chop_range for this loop, instead of stride, it will fail.
-    // The problem does not seem to be in chop_range, but rather in how the loops are merged.
-    // This is GitHub issue #562
-    for (auto it = cfg->molecules().begin() + offset; it < cfg->molecules().end(); it += nChunks)
-    {
-        auto &atoms = (*it)->atoms();
-
-        for_each_pair(atoms.begin(), atoms.end(), [box, &originalgr](int index, auto &i, int jndex, auto &j) {
-            // Ignore atom on itself
-            if (index == jndex)
-                return;
-
-            double distance;
-            if (i->cell()->mimRequired(j->cell()))
-                distance = box->minimumDistance(i->r(), j->r());
-            else
-                distance = (i->r() - j->r()).magnitude();
-            originalgr.boundHistogram(i->localTypeIndex(), j->localTypeIndex()).bin(distance);
-        });
-    }
-
+    calculateBoundGR(cfg, originalgr, offset, nChunks);
     timer.stop();
     Messenger::print("Finished calculation of intramolecular partials ({} elapsed, {} comms).\n", timer.totalTimeString(),
                      procPool.accumulatedTimeString());
@@ -381,12 +569,13 @@ bool RDFModule::calculateGR(GenericList &processingData, ProcessPool &procPool,
     procPool.resetAccumulatedTime();
     timer.start();
     auto success = for_each_pair_early(
-        0, originalgr.nAtomTypes(), [&originalgr, &procPool, method](auto typeI, auto typeJ) -> EarlyReturn<bool> {
-            // Sum histogram data from all processes (except if using RDFModule::TestMethod, where all
-            // processes have all data already)
+        0, originalgr.nAtomTypes(),
+        [&originalgr, &procPool, method, incremental](auto typeI, auto typeJ) -> EarlyReturn<bool> {
+            // Sum histogram data from all processes (except if using RDFModule::TestMethod, where all processes have all
+            // data already, or for full histograms which were updated incrementally, and which are therefore already summed)
             if (method != RDFModule::TestMethod)
             {
-                if (!originalgr.fullHistogram(typeI, typeJ).allSum(procPool))
+                if (!incremental && !originalgr.fullHistogram(typeI, typeJ).allSum(procPool))
                     return false;
                 if (!originalgr.boundHistogram(typeI, typeJ).allSum(procPool))
                     return false;
@@ -416,6 +605,10 @@ bool RDFModule::calculateGR(GenericList &processingData, ProcessPool &procPool,
 
     originalgr.setFingerprint(fmt::format("{}", cfg->contentsVersion()));
 
+    // Start logging changes to the Configuration so that the next calculation can be made incrementally
+    if (incrementalRebuildFrequency > 0)
+        cfg->resetChangeLog();
+
     return true;
 }
 
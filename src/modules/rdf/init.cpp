@@ -37,6 +37,10 @@ void RDFModule::initialise()
     keywords_.add("Control", new IntegerKeyword(0, 0, 100), "Smoothing",
                   "Specifies the degree of smoothing 'n' to apply to calculated g(r), where 2n+1 controls the length in "
                   "the applied Spline smooth");
+    keywords_.add("Control", new IntegerKeyword(0, 0), "IncrementalRebuildFrequency",
+                  "Update partials incrementally from logged Monte Carlo moves where possible, forcing a full recalculation "
+                  "after this many consecutive updates (0 = always recalculate)",
+                  "<0>");
 
     // Test
     keywords_.add("Test", new BoolKeyword(false), "InternalTest",
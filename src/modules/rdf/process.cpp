@@ -33,6 +33,7 @@ bool RDFModule::process(Dissolve &dissolve, ProcessPool &procPool)
     const bool internalTest = keywords_.asBool("InternalTest");
     const bool saveData = keywords_.asBool("Save");
     const auto smoothing = keywords_.asInt("Smoothing");
+    const auto incrementalRebuildFrequency = keywords_.asInt("IncrementalRebuildFrequency");
 
     // Print argument/parameter summary
     if (useHalfCellRange)
@@ -51,6 +52,10 @@ bool RDFModule::process(Dissolve &dissolve, ProcessPool &procPool)
         Messenger::print("RDF: Broadening to be applied to intramolecular g(r) is {} ({}).",
                          Functions::function1D().keyword(intraBroadening.type()), intraBroadening.parameterSummary());
     Messenger::print("RDF: Calculation method is '{}'.\n", partialsMethods().keyword(method));
+    if (incrementalRebuildFrequency > 0)
+        Messenger::print("RDF: Partials will be updated incrementally where possible, with a full recalculation after "
+                         "every {} updates.\n",
+                         incrementalRebuildFrequency);
     Messenger::print("RDF: Save data is {}.\n", DissolveSys::onOff(saveData));
     Messenger::print("RDF: Degree of smoothing to apply to calculated partial g(r) is {} ({}).\n", smoothing,
                      DissolveSys::onOff(smoothing > 0));
@@ -88,7 +93,8 @@ bool RDFModule::process(Dissolve &dissolve, ProcessPool &procPool)
 
         // Calculate unweighted partials for this Configuration
         bool alreadyUpToDate;
-        calculateGR(dissolve.processingModuleData(), procPool, cfg, method, rdfRange, binWidth, alreadyUpToDate);
+        calculateGR(dissolve.processingModuleData(), procPool, cfg, method, rdfRange, binWidth, alreadyUpToDate,
+                    incrementalRebuildFrequency);
         auto &originalgr =
             dissolve.processingModuleData().retrieve<PartialSet>(fmt::format("{}//OriginalGR", cfg->niceName()), uniqueName_);
 
@@ -6,6 +6,7 @@
 #include "classes/data1dstore.h"
 #include "classes/partialset.h"
 #include "module/module.h"
+#include <map>
 
 // Forward Declarations
 class Dissolve;
@@ -72,6 +73,10 @@ class RDFModule : public Module
     private:
     // Test data
     Data1DStore testData_;
+    // Per-type atomic coordinate buffers used by the simple double-loop calculation
+    std::vector<std::vector<Vec3<double>>> typeCoordinates_;
+    // Number of consecutive incremental updates made to the partials of each Configuration
+    std::map<const Configuration *, int> nIncrementalUpdates_;
 
     private:
     // Calculate partial g(r) in serial with simple double-loop
@@ -80,6 +85,10 @@ class RDFModule : public Module
     bool calculateGRSimple(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange);
     // Calculate partial g(r) utilising Cell neighbour lists
     bool calculateGRCells(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth);
+    // Calculate bound partial g(r) histograms, considering Molecules with the specified start/stride
+    void calculateBoundGR(Configuration *cfg, PartialSet &partialSet, int offset, int nChunks);
+    // Update full partial g(r) histograms incrementally from the Configuration's change log
+    bool calculateGRIncremental(ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth);
 
     public:
     // Calculate and return effective density for based on the target Configurations
@@ -88,7 +97,8 @@ class RDFModule : public Module
     std::vector<std::pair<const Species *, double>> speciesPopulations() const;
     // (Re)calculate partial g(r) for the specified Configuration
     bool calculateGR(GenericList &processingData, ProcessPool &procPool, Configuration *cfg, RDFModule::PartialsMethod method,
-                     const double rdfRange, const double rdfBinWidth, bool &alreadyUpToDate);
+                     const double rdfRange, const double rdfBinWidth, bool &alreadyUpToDate,
+                     int incrementalRebuildFrequency = 0);
     // Calculate smoothed/broadened partial g(r) from supplied partials
     static bool calculateUnweightedGR(ProcessPool &procPool, Configuration *cfg, const PartialSet &originalgr,
                                       PartialSet &weightedgr, const Functions::Function1DWrapper intraBroadening,
@@ -3,7 +3,6 @@
 
 #include "classes/box.h"
 #include "classes/configuration.h"
-#include "math/ft.h"
 #include "modules/sq/sq.h"
 #include "templates/algorithms.h"
 
@@ -22,26 +21,37 @@ bool SQModule::calculateUnweightedSQ(ProcessPool &procPool, const PartialSet &un
 
     // Subtract 1.0 from the full and unbound partials so as to give (g(r)-1) and FT into S(Q)
     // Don't subtract 1.0 from the bound partials
-    // TODO Parallelise this
     procPool.resetAccumulatedTime();
     Timer timer;
     timer.start();
+    std::vector<Data1D *> transformTargets;
     for_each_pair(0, unweightedgr.nAtomTypes(), [&](int n, int m) {
         // Total partial
         unweightedsq.partial(n, m).copyArrays(unweightedgr.partial(n, m));
         unweightedsq.partial(n, m) -= 1.0;
-        Fourier::sineFT(unweightedsq.partial(n, m), 4.0 * PI * rho, qMin, qDelta, qMax, windowFunction, broadening);
+        transformTargets.push_back(&unweightedsq.partial(n, m));
 
         // Bound partial
         unweightedsq.boundPartial(n, m).copyArrays(unweightedgr.boundPartial(n, m));
-        Fourier::sineFT(unweightedsq.boundPartial(n, m), 4.0 * PI * rho, qMin, qDelta, qMax, windowFunction, broadening);
+        transformTargets.push_back(&unweightedsq.boundPartial(n, m));
 
         // Unbound partial
         unweightedsq.unboundPartial(n, m).copyArrays(unweightedgr.unboundPartial(n, m));
         unweightedsq.unboundPartial(n, m) -= 1.0;
-        Fourier::sineFT(unweightedsq.unboundPartial(n, m), 4.0 * PI * rho, qMin, qDelta, qMax, windowFunction, broadening);
+        transformTargets.push_back(&unweightedsq.unboundPartial(n, m));
     });
 
+    // Transform all partials at once, using a kernel which is only regenerated if the grids, window, or broadening change
+    // Blocks of Q values are divided over processes and threads, and the results gathered on all processes
+    if (!transformTargets.empty())
+    {
+        if (transformKernel_.setUp(*transformTargets.front(), qMin, qDelta, qMax, windowFunction, broadening))
+            Messenger::print("Regenerated partial S(Q) transform kernel ({} Q points x {} r points).\n",
+                             transformKernel_.omega().size(), transformTargets.front()->nValues());
+        if (!transformKernel_.transform(procPool, ProcessPool::PoolStrategy, transformTargets, 4.0 * PI * rho))
+            return false;
+    }
+
     // Sum into total
     unweightedsq.formTotal(true);
 
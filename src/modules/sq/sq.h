@@ -5,6 +5,7 @@
 
 #include "classes/data1dstore.h"
 #include "classes/partialset.h"
+#include "math/sineftkernel.h"
 #include "math/windowfunction.h"
 #include "module/module.h"
 
@@ -58,12 +59,14 @@ class SQModule : public Module
     private:
     // Test data
     Data1DStore testData_;
+    // Transform kernel for partial g(r) -> S(Q)
+    SineFTKernel transformKernel_;
 
     public:
     // Calculate unweighted S(Q) from unweighted g(r)
-    static bool calculateUnweightedSQ(ProcessPool &procPool, const PartialSet &unweightedgr, PartialSet &unweightedsq,
-                                      double qMin, double qDelta, double qMax, double rho, const WindowFunction &windowFunction,
-                                      Functions::Function1DWrapper broadening);
+    bool calculateUnweightedSQ(ProcessPool &procPool, const PartialSet &unweightedgr, PartialSet &unweightedsq,
+                               double qMin, double qDelta, double qMax, double rho, const WindowFunction &windowFunction,
+                               Functions::Function1DWrapper broadening);
 
     /*
      * GUI Widget
@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2021 Team Dissolve and contributors
+#pragma once
 #include "parallel_defs.h"
+#include "templates/algorithms.h"
+#include <vector>
 
 namespace dissolve
 {
@@ -59,4 +62,77 @@ template <class ValueType> class CombinableValue
     dissolve::combinable<ValueType> combinable_;
 };
 
+// A sparse combinable vector used in multithreading operations
+// Each thread accumulates into its own blocked buffer, in which fixed-size blocks of elements are only allocated when first
+// touched, so memory and reduction cost scale with the number of elements each thread actually writes to rather than with
+// the full size of the parent vector. Best suited to operations where each thread writes to a (spatially) localised subset
+// of the parent's elements.
+
+// Usage:
+// - Create an instance by passing in the parent vector
+// - Capture the combinable by reference in the lambda operator of the parallel operation
+// - Within the lambda operator call local() to access a thread local buffer, and index it exactly as the parent vector
+// - After the parallel operation call finalize to accumulate (in parallel over blocks) into the parent vector.
+template <class T, int BlockSize = 256> class CombinableBlockedVector
+{
+    public:
+    // Thread local buffer
+    class LocalBuffer
+    {
+        public:
+        LocalBuffer(int size = 0) : blocks_(size / BlockSize + 1) {}
+
+        private:
+        // Blocks of elements, empty until first touched
+        std::vector<std::vector<T>> blocks_;
+
+        public:
+        // Return reference to the specified element, allocating its block if necessary
+        T &operator[](int index)
+        {
+            auto &block = blocks_[index / BlockSize];
+            if (block.empty())
+                block.resize(BlockSize, T());
+            return block[index % BlockSize];
+        }
+        // Return blocks
+        const std::vector<std::vector<T>> &blocks() const { return blocks_; }
+    };
+
+    CombinableBlockedVector(std::vector<T> &parent)
+        : parent_(parent), combinable_([&parent]() { return LocalBuffer(parent.size()); })
+    {
+    }
+    void finalize()
+    {
+        // Gather the thread local buffers
+        std::vector<const LocalBuffer *> buffers;
+        combinable_.combine_each([&buffers](const auto &buffer) { buffers.push_back(&buffer); });
+        if (buffers.empty())
+            return;
+
+        // Sum touched blocks into the parent, in parallel over blocks
+        auto nBlocks = buffers.front()->blocks().size();
+        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(nBlocks),
+                           [&](const auto blockIndex) {
+                               auto offset = blockIndex * BlockSize;
+                               auto nElements = std::min(int(parent_.size()) - offset, BlockSize);
+                               for (const auto *buffer : buffers)
+                               {
+                                   auto &block = buffer->blocks()[blockIndex];
+                                   if (block.empty())
+                                       continue;
+                                   for (auto n = 0; n < nElements; ++n)
+                                       parent_[offset + n] += block[n];
+                               }
+                           });
+    }
+
+    LocalBuffer &local() { return combinable_.local(); }
+
+    private:
+    std::vector<T> &parent_;
+    dissolve::combinable<LocalBuffer> combinable_;
+};
+
 } // namespace dissolve
\ No newline at end of file
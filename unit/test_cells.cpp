@@ -93,11 +93,35 @@ TEST(CellsTest, Basic)
         cfg->cells().generate(cfg->box(), cellSize, dissolve.pairPotentialRange());
         cfg->updateCellContents();
 
+        // Check cell neighbour pair colouring - every pair appears once, and no Cell appears twice within a colour
+        std::vector<int> pairCounts(cfg->cells().getCellNeighbourPairs().size(), 0);
+        for (auto &colour : cfg->cells().getCellNeighbourPairColours())
+        {
+            std::vector<bool> cellUsed(cfg->cells().nCells(), false);
+            for (auto pairIndex : colour)
+            {
+                auto &pair = cfg->cells().getCellNeighbourPairs()[pairIndex];
+                ++pairCounts[pairIndex];
+                EXPECT_FALSE(cellUsed[pair.master_.index()]);
+                cellUsed[pair.master_.index()] = true;
+                if (&pair.master_ == &pair.neighbour_)
+                    continue;
+                EXPECT_FALSE(cellUsed[pair.neighbour_.index()]);
+                cellUsed[pair.neighbour_.index()] = true;
+            }
+        }
+        EXPECT_TRUE(std::all_of(pairCounts.begin(), pairCounts.end(), [](const auto count) { return count == 1; }));
+
         // Calculate total Cell-based energy
         EXPECT_NEAR(refEnergy, energyKernel.energy(cfg->cells(), false, ProcessPool::PoolStrategy, false), 1.0e-4);
 
         // Calculate atomic energy from the Ar
-        EXPECT_NEAR(refEnergy, energyKernel.energy(*cfg->atom(0)), 1.0e-4);
+        EXPECT_NEAR(refEnergy, energyKernel.energy(*cfg->molecule(0)->atom(0)), 1.0e-4);
+
+        // Spatially reorder atoms - should make no difference to either energy
+        cfg->reorderAtoms();
+        EXPECT_NEAR(refEnergy, energyKernel.energy(cfg->cells(), false, ProcessPool::PoolStrategy, false), 1.0e-4);
+        EXPECT_NEAR(refEnergy, energyKernel.energy(*cfg->molecule(0)->atom(0)), 1.0e-4);
     }
 }
 
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/cell.h"
+#include "classes/checkerboarddistributor.h"
+#include "main/dissolve.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+
+TEST(CheckerboardTest, Separation)
+{
+    CoreData coreData;
+    Dissolve dissolve(coreData);
+
+    // Twelve cells along each side, each of which neighbours one cell either side
+    auto *cfg = dissolve.addConfiguration();
+    cfg->createBox({60, 60, 60}, {90, 90, 90});
+    auto &cells = cfg->cells();
+    cells.generate(cfg->box(), 5.0, 5.0);
+    ASSERT_EQ(cells.divisions().x, 12);
+
+    // Modifications extend one cell beyond each block, so blocks must be at least three cells wide
+    CheckerboardDistributor checkerboard(cells, 2.0);
+    EXPECT_EQ(checkerboard.nBlocks().x, 4);
+    EXPECT_EQ(checkerboard.nBlocks().y, 4);
+    EXPECT_EQ(checkerboard.nBlocks().z, 4);
+    EXPECT_EQ(checkerboard.colours().size(), 8);
+    EXPECT_TRUE(checkerboard.isConcurrent());
+
+    // Map blocks to colours
+    std::vector<int> blockColours(64, -1);
+    for (auto colour = 0; colour < checkerboard.colours().size(); ++colour)
+        for (auto block : checkerboard.colours()[colour])
+            blockColours[block] = colour;
+    EXPECT_EQ(std::count(blockColours.begin(), blockColours.end(), -1), 0);
+
+    // Cells in different blocks of the same colour must be further apart than the modification and neighbour extents
+    for (auto n = 0; n < cells.nCells(); ++n)
+    {
+        const auto *a = cells.cell(n);
+        auto blockA = checkerboard.block(a);
+        for (auto m = n + 1; m < cells.nCells(); ++m)
+        {
+            const auto *b = cells.cell(m);
+            auto blockB = checkerboard.block(b);
+            if (blockA == blockB || blockColours[blockA] != blockColours[blockB])
+                continue;
+            auto delta = cells.mimGridDelta(a, b);
+            EXPECT_TRUE(abs(delta.x) > 3 || abs(delta.y) > 3 || abs(delta.z) > 3);
+        }
+    }
+}
+
+TEST(CheckerboardTest, SmallBox)
+{
+    CoreData coreData;
+    Dissolve dissolve(coreData);
+
+    // Blocks cannot be separated sufficiently, so everything must be in a single block
+    auto *cfg = dissolve.addConfiguration();
+    cfg->createBox({20, 20, 20}, {90, 90, 90});
+    cfg->cells().generate(cfg->box(), 5.0, 5.0);
+    CheckerboardDistributor checkerboard(cfg->cells(), 2.0);
+    EXPECT_EQ(checkerboard.colours().size(), 1);
+    EXPECT_FALSE(checkerboard.isConcurrent());
+}
+
+} // namespace UnitTest
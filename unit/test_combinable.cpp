@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "templates/algorithms.h"
+#include "templates/combinable.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+
+TEST(CombinableTest, BlockedVector)
+{
+    // Parent vector with existing data, and a size which is not a multiple of the block size
+    const auto nElements = 1000;
+    std::vector<double> parent(nElements, 1.0);
+
+    // Each index adds to itself and a distant partner, touching a sparse subset of blocks
+    auto combinable = dissolve::CombinableBlockedVector<double, 64>(parent);
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(100),
+                       [&combinable](const auto n) {
+                           auto &local = combinable.local();
+                           local[n] += 2.0;
+                           local[nElements - 1 - n] -= 1.0;
+                       });
+    combinable.finalize();
+
+    for (auto n = 0; n < nElements; ++n)
+    {
+        if (n < 100)
+            EXPECT_DOUBLE_EQ(parent[n], 3.0);
+        else if (n >= nElements - 100)
+            EXPECT_DOUBLE_EQ(parent[n], 0.0);
+        else
+            EXPECT_DOUBLE_EQ(parent[n], 1.0);
+    }
+}
+
+} // namespace UnitTest
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "math/data1d.h"
+#include "math/ft.h"
+#include "math/sineftkernel.h"
+#include "templates/algorithms.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+class FourierTransformTest : public ::testing::Test
+{
+    public:
+    FourierTransformTest() = default;
+
+    // Generate damped oscillatory test function resembling g(r) - 1 on a uniform grid
+    Data1D generate(double xBegin = 0.005, double xEnd = 30.0, double xDelta = 0.01)
+    {
+        Data1D d;
+        auto nPoints = int((xEnd - xBegin) / xDelta) + 1;
+        for (auto n = 0; n < nPoints; ++n)
+        {
+            auto x = xBegin + n * xDelta;
+            d.addPoint(x, exp(-0.2 * x) * sin(2.5 * x) - exp(-2.0 * x * x));
+        }
+        return d;
+    }
+
+    // Compare fast and direct transforms of the supplied data
+    void compare(const Data1D &source, double wMin, double wStep, double wMax, WindowFunction window,
+                 const Functions::Function1DWrapper &broadening = Functions::Function1DWrapper())
+    {
+        auto direct = source, fast = source;
+        ASSERT_TRUE(Fourier::sineFT(direct, 4.0 * M_PI, wMin, wStep, wMax, window, broadening, Fourier::SineFTMethod::Direct));
+        ASSERT_TRUE(Fourier::sineFT(fast, 4.0 * M_PI, wMin, wStep, wMax, window, broadening, Fourier::SineFTMethod::Fast));
+
+        ASSERT_EQ(direct.nValues(), fast.nValues());
+        auto maxValue = *std::max_element(direct.values().begin(), direct.values().end(),
+                                          [](const auto a, const auto b) { return fabs(a) < fabs(b); });
+        for (auto &&[xD, xF, yD, yF] : zip(direct.xAxis(), fast.xAxis(), direct.values(), fast.values()))
+        {
+            EXPECT_DOUBLE_EQ(xD, xF);
+            EXPECT_NEAR(yD, yF, 1.0e-8 * fabs(maxValue));
+        }
+    }
+};
+
+TEST_F(FourierTransformTest, FastMatchesDirect)
+{
+    auto data = generate();
+
+    // No window or broadening, with and without omega = 0
+    compare(data, 0.0, 0.05, 30.0, WindowFunction());
+    compare(data, 0.5, 0.01, 20.0, WindowFunction());
+
+    // Window function and omega-independent broadening
+    compare(data, 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0));
+    compare(data, 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0),
+            Functions::Function1DWrapper(Functions::Function1D::Gaussian, {0.1}));
+
+    // Single output point
+    compare(data, 1.0, 0.1, 1.0, WindowFunction());
+}
+
+TEST_F(FourierTransformTest, Fallback)
+{
+    // Non-uniform grid - fast transform must fall back to the direct sum
+    Data1D nonUniform;
+    for (auto n = 1; n < 500; ++n)
+    {
+        auto x = 0.001 * n * n;
+        nonUniform.addPoint(x, exp(-x) * sin(3.0 * x));
+    }
+    compare(nonUniform, 0.05, 0.05, 20.0, WindowFunction());
+
+    // Omega-dependent broadening - fast transform must fall back to the direct sum
+    EXPECT_TRUE(Functions::Function1DWrapper(Functions::Function1D::OmegaDependentGaussian, {0.02}).isOmegaDependent());
+    EXPECT_FALSE(Functions::Function1DWrapper(Functions::Function1D::Gaussian, {0.02}).isOmegaDependent());
+    compare(generate(), 0.05, 0.05, 20.0, WindowFunction(),
+            Functions::Function1DWrapper(Functions::Function1D::OmegaDependentGaussian, {0.02}));
+}
+
+TEST_F(FourierTransformTest, Kernel)
+{
+    // Several datasets on a common axis, transformed by the kernel and individually by the direct sum
+    std::vector<Data1D> sources = {generate(), generate(), generate()};
+    sources[1] *= 2.0;
+    sources[2] -= 1.0;
+    auto broadening = Functions::Function1DWrapper(Functions::Function1D::OmegaDependentGaussian, {0.02});
+    auto window = WindowFunction(WindowFunction::Form::Lorch0);
+
+    SineFTKernel kernel;
+    EXPECT_TRUE(kernel.setUp(sources.front(), 0.05, 0.05, 20.0, window, broadening));
+    EXPECT_FALSE(kernel.setUp(sources.front(), 0.05, 0.05, 20.0, window, broadening));
+
+    auto transformed = sources;
+    std::vector<Data1D *> targets;
+    for (auto &d : transformed)
+        targets.push_back(&d);
+    ASSERT_TRUE(kernel.transform(targets, 4.0 * M_PI));
+
+    for (auto &&[source, result] : zip(sources, transformed))
+    {
+        auto direct = source;
+        ASSERT_TRUE(Fourier::sineFT(direct, 4.0 * M_PI, 0.05, 0.05, 20.0, window, broadening, Fourier::SineFTMethod::Direct));
+        ASSERT_EQ(direct.nValues(), result.nValues());
+        for (auto &&[xD, xK, yD, yK] : zip(direct.xAxis(), result.xAxis(), direct.values(), result.values()))
+        {
+            EXPECT_DOUBLE_EQ(xD, xK);
+            EXPECT_NEAR(yD, yK, 1.0e-10);
+        }
+    }
+
+    // Changing the broadening must regenerate the kernel, while mismatched data must be rejected
+    EXPECT_TRUE(kernel.setUp(sources.front(), 0.05, 0.05, 20.0, window, Functions::Function1DWrapper()));
+    auto shorter = generate(0.005, 10.0);
+    EXPECT_FALSE(kernel.transform({&shorter}, 1.0));
+}
+
+} // namespace UnitTest
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "classes/moleculeenergycache.h"
+#include "classes/box.h"
+#include "classes/energykernel.h"
+#include "classes/pairpotential.h"
+#include "main/dissolve.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace UnitTest
+{
+
+// Lennard-Jones dimers at liquid-like density
+const std::string dimersInput = R"(
+PairPotentials
+  Range  8.000000
+  Delta  0.005000
+  Parameters  'AR'  Ar  0.0  LJGeometric  0.9  3.4
+EndPairPotentials
+
+Species 'Dimer'
+  Atom    1    Ar    0.0  0.0  0.0  'AR'
+  Atom    2    Ar    3.8  0.0  0.0  'AR'
+  Bond    1    2     Harmonic  3000.0  3.8
+EndSpecies
+
+Configuration  'Dimers'
+  Generator
+    AddSpecies
+      Density  0.02  atoms/A3
+      Population  100
+      Species  'Dimer'
+    EndAddSpecies
+  EndGenerator
+  CellDivisionLength  4.0
+EndConfiguration
+
+Simulation
+  Seed  1
+EndSimulation
+)";
+
+// Check all cached energies against a fresh calculation
+void checkEnergies(const Configuration *cfg, EnergyKernel &kernel, const MoleculeEnergyCache &cache)
+{
+    MoleculeEnergyCache reference;
+    reference.calculate(cfg, kernel, 8.0);
+    for (auto n = 0; n < cfg->nMolecules(); ++n)
+        EXPECT_NEAR(cache.energy(n), reference.energy(n), 1.0e-6 * std::max(1.0, fabs(reference.energy(n))));
+}
+
+TEST(MoleculeEnergyCacheTest, Update)
+{
+    CoreData coreData;
+    Dissolve dissolve(coreData);
+    Messenger::setQuiet(true);
+    ASSERT_TRUE(dissolve.loadInputFromString(dimersInput));
+    ASSERT_TRUE(dissolve.prepare());
+    auto *cfg = dissolve.configurations().front().get();
+    const auto *box = cfg->box();
+
+    EnergyKernel kernel(dissolve.worldPool(), cfg, dissolve.potentialMap());
+    MoleculeEnergyCache cache;
+    cache.calculate(cfg, kernel, 8.0);
+    ASSERT_TRUE(cache.isValid(cfg, 8.0));
+    EXPECT_FALSE(cache.isValid(cfg, 6.0));
+
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> moleculeIndex(0, cfg->nMolecules() - 1);
+    std::uniform_real_distribution<double> displacement(-1.0, 1.0);
+    std::vector<std::pair<int, double>> moleculeEnergies;
+    for (auto move = 0; move < 50; ++move)
+    {
+        auto molId = moleculeIndex(generator);
+        auto mol = cfg->molecule(molId);
+
+        // Alternate between small displacements and jumps alongside another Molecule, gaining and losing neighbours
+        Vec3<double> rDelta(displacement(generator), displacement(generator), displacement(generator));
+        if (move % 2 == 1)
+        {
+            auto other = cfg->molecule(moleculeIndex(generator));
+            if (other == mol)
+                continue;
+            rDelta = box->minimumVector(mol->centreOfGeometry(box), other->centreOfGeometry(box)) + rDelta * 0.5 +
+                     Vec3<double>(0.0, 0.0, 4.0);
+        }
+        mol->translate(rDelta);
+        cfg->updateCellLocation(mol);
+
+        // Accept the move
+        kernel.energy(*mol, moleculeEnergies);
+        cache.update(molId, moleculeEnergies);
+
+        checkEnergies(cfg, kernel, cache);
+    }
+}
+
+TEST(MoleculeEnergyCacheTest, Invalidation)
+{
+    CoreData coreData;
+    Dissolve dissolve(coreData);
+    Messenger::setQuiet(true);
+    ASSERT_TRUE(dissolve.loadInputFromString(dimersInput));
+    ASSERT_TRUE(dissolve.prepare());
+    auto *cfg = dissolve.configurations().front().get();
+
+    EnergyKernel kernel(dissolve.worldPool(), cfg, dissolve.potentialMap());
+    MoleculeEnergyCache cache;
+    cache.calculate(cfg, kernel, 8.0);
+    ASSERT_TRUE(cache.isValid(cfg, 8.0));
+
+    // External modification of the Configuration contents
+    cfg->incrementContentsVersion();
+    EXPECT_FALSE(cache.isValid(cfg, 8.0));
+    cache.setContentsVersion(cfg->contentsVersion());
+    EXPECT_TRUE(cache.isValid(cfg, 8.0));
+
+    // Recalculation of pair potentials
+    dissolve.pairPotentials().front()->calculateUOriginal();
+    EXPECT_FALSE(cache.isValid(cfg, 8.0));
+    cache.calculate(cfg, kernel, 8.0);
+    EXPECT_TRUE(cache.isValid(cfg, 8.0));
+
+    // Explicit invalidation
+    cache.invalidate();
+    EXPECT_FALSE(cache.isValid(cfg, 8.0));
+}
+
+} // namespace UnitTest
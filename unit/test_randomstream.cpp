@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "base/randomstream.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+
+TEST(RandomStreamTest, KnownAnswers)
+{
+    // Reference values from the Random123 distribution
+    EXPECT_EQ(RandomStream::philox({0, 0, 0, 0}, {0, 0}),
+              (std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(RandomStream::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(RandomStream::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(RandomStreamTest, Streams)
+{
+    const auto nValues = 10000;
+
+    // Streams with identical identifiers must be identical, and those with any differing identifier must differ
+    RandomStream a(12345, 1, 2, 3), b(12345, 1, 2, 3);
+    std::vector<RandomStream> others = {RandomStream(12346, 1, 2, 3), RandomStream(12345, 2, 2, 3),
+                                        RandomStream(12345, 1, 3, 3), RandomStream(12345, 1, 2, 4)};
+    auto sum = 0.0;
+    std::vector<int> nSame(others.size(), 0);
+    for (auto n = 0; n < nValues; ++n)
+    {
+        auto x = a.random();
+        EXPECT_EQ(x, b.random());
+        EXPECT_GE(x, 0.0);
+        EXPECT_LT(x, 1.0);
+        sum += x;
+        for (auto m = 0; m < others.size(); ++m)
+            if (others[m].random() == x)
+                ++nSame[m];
+    }
+    for (auto same : nSame)
+        EXPECT_EQ(same, 0);
+    EXPECT_NEAR(sum / nValues, 0.5, 0.01);
+}
+
+} // namespace UnitTest
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2021 Team Dissolve and contributors
+
+#include "data/sg/spacegroup.h"
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+
+TEST(SpacegroupTest, EquivalentReflections)
+{
+    Spacegroup sg;
+    EXPECT_FALSE(sg.isSet());
+    EXPECT_FALSE(sg.set("NotASpacegroup"));
+
+    // Triclinic - Friedel mates only
+    ASSERT_TRUE(sg.set("P1"));
+    EXPECT_EQ(sg.equivalentReflections({1, 2, 3}).size(), 2);
+
+    // Cubic (m-3m Laue class), given by symbol or number
+    for (auto name : {"Fm-3m", "225"})
+    {
+        ASSERT_TRUE(sg.set(name));
+        EXPECT_EQ(sg.equivalentReflections({1, 0, 0}).size(), 6);
+        EXPECT_EQ(sg.equivalentReflections({1, 1, 0}).size(), 12);
+        EXPECT_EQ(sg.equivalentReflections({1, 1, 1}).size(), 8);
+        EXPECT_EQ(sg.equivalentReflections({1, 2, 3}).size(), 48);
+    }
+
+    // Orthorhombic (mmm Laue class)
+    ASSERT_TRUE(sg.set("Pnma"));
+    EXPECT_EQ(sg.equivalentReflections({1, 0, 0}).size(), 2);
+    EXPECT_EQ(sg.equivalentReflections({1, 1, 1}).size(), 8);
+
+    // Hexagonal (6/mmm Laue class)
+    ASSERT_TRUE(sg.set("P63/mmc"));
+    EXPECT_EQ(sg.equivalentReflections({1, 0, 0}).size(), 6);
+    EXPECT_EQ(sg.equivalentReflections({1, 2, 3}).size(), 24);
+
+    // All equivalents of a general reflection must be distinct and share its magnitude in a cubic cell
+    ASSERT_TRUE(sg.set("Fm-3m"));
+    for (const auto &hkl : sg.equivalentReflections({1, 2, 3}))
+        EXPECT_EQ(hkl.x * hkl.x + hkl.y * hkl.y + hkl.z * hkl.z, 14);
+}
+
+TEST(SpacegroupTest, Compatibility)
+{
+    // Test compatibility with the unit cell of a cubic 20 Angstrom box with the specified multiplicity
+    auto isCompatible = [](const Spacegroup &sg, Vec3<int> multiplicity) {
+        const auto ra = 2.0 * M_PI / 20.0;
+        return sg.isCompatible({ra * multiplicity.x, 0.0, 0.0}, {0.0, ra * multiplicity.y, 0.0},
+                               {0.0, 0.0, ra * multiplicity.z});
+    };
+
+    Spacegroup fm3m, p4mmm, pnma;
+    ASSERT_TRUE(fm3m.set("Fm-3m"));
+    ASSERT_TRUE(p4mmm.set("P4/mmm"));
+    ASSERT_TRUE(pnma.set("Pnma"));
+
+    // Isotropic multiplicity gives a cubic unit cell
+    EXPECT_TRUE(isCompatible(fm3m, {2, 2, 2}));
+    EXPECT_TRUE(isCompatible(p4mmm, {2, 2, 2}));
+    EXPECT_TRUE(isCompatible(pnma, {2, 2, 2}));
+
+    // Anisotropic multiplicity gives a tetragonal unit cell, incompatible with cubic operators
+    EXPECT_FALSE(isCompatible(fm3m, {2, 2, 1}));
+    EXPECT_TRUE(isCompatible(p4mmm, {2, 2, 1}));
+    EXPECT_TRUE(isCompatible(pnma, {2, 2, 1}));
+
+    // Orthorhombic unit cell
+    EXPECT_FALSE(isCompatible(fm3m, {1, 2, 4}));
+    EXPECT_FALSE(isCompatible(p4mmm, {1, 2, 4}));
+    EXPECT_TRUE(isCompatible(pnma, {1, 2, 4}));
+}
+
+} // namespace UnitTest